@@ -0,0 +1,58 @@
+#include "admission_queue.h"
+
+#include "metrics.h"
+
+AdmissionQueue::Ticket::Ticket(Ticket&& other)
+	: queue_(other.queue_), lane_(other.lane_), places_(other.places_), admitted_(other.admitted_),
+	  started_(other.started_) {
+	other.queue_ = nullptr;
+}
+
+AdmissionQueue::Ticket& AdmissionQueue::Ticket::operator=(Ticket&& other) {
+	if (this != &other) {
+		leave();
+		queue_ = other.queue_;
+		lane_ = other.lane_;
+		places_ = other.places_;
+		admitted_ = other.admitted_;
+		started_ = other.started_;
+		other.queue_ = nullptr;
+	}
+	return *this;
+}
+
+AdmissionQueue::Ticket::~Ticket() {
+	leave();
+}
+
+void AdmissionQueue::Ticket::leave() {
+	if (queue_ != nullptr)
+		queue_->inFlight_[static_cast<int>(lane_)].fetch_sub(places_, std::memory_order_relaxed);
+	queue_ = nullptr;
+}
+
+void AdmissionQueue::Ticket::started() {
+	if (queue_ == nullptr || started_)
+		return;
+	started_ = true;
+	metrics::RecordQueueWait(std::chrono::steady_clock::now() - admitted_);
+}
+
+AdmissionQueue::AdmissionQueue(int maxInteractive, int maxBulk) {
+	maxInFlight_[static_cast<int>(Lane::Interactive)] = maxInteractive;
+	maxInFlight_[static_cast<int>(Lane::Bulk)] = maxBulk;
+	for (std::atomic<int>& inFlight : inFlight_)
+		inFlight.store(0, std::memory_order_relaxed);
+}
+
+AdmissionQueue::Ticket AdmissionQueue::tryEnter(Lane lane, int places) {
+	std::atomic<int>& inFlight = inFlight_[static_cast<int>(lane)];
+	const int maxInFlight = maxInFlight_[static_cast<int>(lane)];
+	const int previous = inFlight.fetch_add(places, std::memory_order_relaxed);
+	if (maxInFlight > 0 && previous + places > maxInFlight) {
+		inFlight.fetch_sub(places, std::memory_order_relaxed);
+		metrics::CountRejected();
+		return Ticket();
+	}
+	return Ticket(this, lane, places);
+}
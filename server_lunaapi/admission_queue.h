@@ -0,0 +1,72 @@
+#ifndef LUNAAPI_ADMISSION_QUEUE_H
+#define LUNAAPI_ADMISSION_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+
+#include "priority_lanes.h"
+
+// Bounds the calls of each lane inside the server, processed or waiting
+// for an estimator set. Calls beyond the limit are turned away at once with
+// RESOURCE_EXHAUSTED instead of queueing up behind everyone else, so a
+// burst costs a few rejections rather than latency for every call, and a
+// bulk job cannot fill the server for interactive calls.
+class AdmissionQueue {
+ public:
+	// A call's place in the server; frees it on destruction.
+	class Ticket {
+	 public:
+		// Empty: the call was rejected.
+		Ticket() = default;
+		Ticket(Ticket&& other);
+		Ticket& operator=(Ticket&& other);
+		~Ticket();
+
+		explicit operator bool() const { return queue_ != nullptr; }
+
+		// Records the time since admission as queue wait. Called once the
+		// call holds what it needs to start processing.
+		void started();
+
+		// When the call was admitted, for calls recording the wait of each
+		// of their places themselves.
+		std::chrono::steady_clock::time_point admitted() const { return admitted_; }
+
+	 private:
+		friend class AdmissionQueue;
+		Ticket(AdmissionQueue* queue, Lane lane, int places)
+			: queue_(queue), lane_(lane), places_(places), admitted_(std::chrono::steady_clock::now()) {}
+		Ticket(const Ticket&) = delete;
+		Ticket& operator=(const Ticket&) = delete;
+
+		void leave();
+
+		AdmissionQueue* queue_ = nullptr;
+		Lane lane_ = Lane::Interactive;
+		int places_ = 0;
+		std::chrono::steady_clock::time_point admitted_;
+		bool started_ = false;
+	};
+
+	// At most maxInteractive interactive and maxBulk bulk calls are
+	// admitted at a time; 0 admits all calls of the lane.
+	AdmissionQueue(int maxInteractive, int maxBulk);
+
+	// Returns an empty ticket, and counts the rejection, when the lane is
+	// full. A call of several images, such as a batch, takes a place for
+	// each, all or none, so it is shed like that many single calls.
+	Ticket tryEnter(Lane lane, int places = 1);
+
+	int inFlight(Lane lane) const {
+		return inFlight_[static_cast<int>(lane)].load(std::memory_order_relaxed);
+	}
+
+ private:
+	AdmissionQueue(const AdmissionQueue&) = delete;
+	AdmissionQueue& operator=(const AdmissionQueue&) = delete;
+
+	int maxInFlight_[static_cast<int>(Lane::Count)];
+	std::atomic<int> inFlight_[static_cast<int>(Lane::Count)];
+};
+
+#endif  // LUNAAPI_ADMISSION_QUEUE_H
@@ -0,0 +1,64 @@
+#include "arena_pool.h"
+
+struct ArenaPool::Entry {
+	explicit Entry(size_t blockBytes) : block(new char[blockBytes]), arena(Options(block.get(), blockBytes)) {}
+
+	static google::protobuf::ArenaOptions Options(char* block, size_t blockBytes) {
+		google::protobuf::ArenaOptions options;
+		options.initial_block = block;
+		options.initial_block_size = blockBytes;
+		return options;
+	}
+
+	// Must outlive the arena, which does not free it.
+	std::unique_ptr<char[]> block;
+	google::protobuf::Arena arena;
+};
+
+ArenaPool::Lease::Lease(Lease&& other) : pool_(other.pool_), entry_(other.entry_) {
+	other.pool_ = nullptr;
+	other.entry_ = nullptr;
+}
+
+ArenaPool::Lease::~Lease() {
+	if (pool_ != nullptr)
+		pool_->release(entry_);
+}
+
+google::protobuf::Arena* ArenaPool::Lease::get() const {
+	return &entry_->arena;
+}
+
+ArenaPool::ArenaPool(size_t initialBlockBytes, size_t maxIdle)
+	: initialBlockBytes_(initialBlockBytes), maxIdle_(maxIdle) {}
+
+ArenaPool::~ArenaPool() {
+	for (Entry* entry : idle_)
+		delete entry;
+}
+
+ArenaPool::Lease ArenaPool::acquire() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (!idle_.empty()) {
+			Entry* entry = idle_.back();
+			idle_.pop_back();
+			return Lease(this, entry);
+		}
+	}
+	return Lease(this, new Entry(initialBlockBytes_));
+}
+
+void ArenaPool::release(Entry* entry) {
+	// Runs destructors of the messages and frees every block except the
+	// initial one, outside of the lock.
+	entry->arena.Reset();
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (idle_.size() < maxIdle_) {
+			idle_.push_back(entry);
+			return;
+		}
+	}
+	delete entry;
+}
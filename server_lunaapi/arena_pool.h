@@ -0,0 +1,59 @@
+#ifndef LUNAAPI_ARENA_POOL_H
+#define LUNAAPI_ARENA_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+
+// Protobuf arenas reused across calls. Each arena starts on its own
+// preallocated block, which survives Reset(), so a typical request and
+// reply are built without touching the global allocator and are freed in
+// one shot when the lease ends.
+class ArenaPool {
+ public:
+	struct Entry;
+
+	// Resets the arena and returns it to the pool on destruction.
+	class Lease {
+	 public:
+		Lease(Lease&& other);
+		~Lease();
+
+		google::protobuf::Arena* get() const;
+		google::protobuf::Arena* operator->() const { return get(); }
+
+	 private:
+		friend class ArenaPool;
+		Lease(ArenaPool* pool, Entry* entry) : pool_(pool), entry_(entry) {}
+		Lease(const Lease&) = delete;
+		Lease& operator=(const Lease&) = delete;
+
+		ArenaPool* pool_;
+		Entry* entry_;
+	};
+
+	// initialBlockBytes is the preallocated block of every arena; at most
+	// maxIdle reset arenas are kept for reuse.
+	ArenaPool(size_t initialBlockBytes, size_t maxIdle);
+	~ArenaPool();
+
+	// Never blocks; creates a new arena when none is idle.
+	Lease acquire();
+
+ private:
+	ArenaPool(const ArenaPool&) = delete;
+	ArenaPool& operator=(const ArenaPool&) = delete;
+
+	void release(Entry* entry);
+
+	const size_t initialBlockBytes_;
+	const size_t maxIdle_;
+
+	std::mutex mutex_;
+	std::vector<Entry*> idle_;
+};
+
+#endif  // LUNAAPI_ARENA_POOL_H
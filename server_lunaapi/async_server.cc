@@ -0,0 +1,220 @@
+#include "async_server.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "image_processor.h"
+#include "logger.h"
+#include "raw_image_request.h"
+
+// State of a single Proccesing call. Request and reply are created on a
+// pooled arena, released together with the call.
+template <class Request, class Reply>
+class AsyncServer::CallData final : public AsyncServer::Call {
+ public:
+	CallData(AsyncServer* server, grpc::ServerCompletionQueue* cq)
+		: server_(server), cq_(cq), arena_(server->arenas_.acquire()),
+		  request_(google::protobuf::Arena::Create<Request>(arena_.get())),
+		  reply_(google::protobuf::Arena::Create<Reply>(arena_.get())),
+		  responder_(&ctx_), status_(CREATE) {
+		Proceed(true);
+	}
+
+	void Proceed(bool ok) override {
+		if (status_ == CREATE) {
+			status_ = PROCESS;
+			server_->RequestCall(&ctx_, request_, &responder_, cq_, this);
+		} else if (status_ == PROCESS) {
+			// The queue is shutting down and no call was delivered.
+			if (!ok) {
+				delete this;
+				return;
+			}
+			// Accept the next call while this one is being processed.
+			new CallData(server_, cq_);
+
+			status_ = FINISH;
+			control_ = CallControl(&ctx_, false);
+			ticket_ = server_->admission_.tryEnter(control_.lane());
+			if (!ticket_) {
+				responder_.FinishWithError(OverloadedStatus(), this);
+				return;
+			}
+			server_->workers_.submit([this] {
+				// Waiting in the worker queue counts as queue wait; workers
+				// match the estimator sets, so acquiring one rarely blocks.
+				ticket_.started();
+				const grpc::Status status = server_->Process(*request_, control_, reply_, arena_.get());
+				responder_.Finish(*reply_, status, this);
+			}, control_.deadline(), control_.lane());
+		} else {
+			delete this;
+		}
+	}
+
+ private:
+	AsyncServer* server_;
+	grpc::ServerCompletionQueue* cq_;
+	grpc::ServerContext ctx_;
+	ArenaPool::Lease arena_;
+	Request* request_;
+	Reply* reply_;
+	grpc::ServerAsyncResponseWriter<Reply> responder_;
+	AdmissionQueue::Ticket ticket_;
+	CallControl control_;
+
+	enum CallStatus { CREATE, PROCESS, FINISH };
+	CallStatus status_;
+};
+
+template <class Base>
+grpc::Status AsyncServer::Service<Base>::ProcessStream(grpc::ServerContext* context,
+	grpc::ServerReaderWriter<LunaSDK::ImageProccessingResult, LunaSDK::Image>* stream) {
+	const Lane lane = LaneOf(context);
+	AdmissionQueue::Ticket ticket = admission_.tryEnter(lane);
+	if (!ticket)
+		return OverloadedStatus();
+	EstimatorPool::Lease estimators = pool_.acquire(std::chrono::steady_clock::time_point::max(), lane);
+	ticket.started();
+	return ProcessImageStream(*estimators, context, stream);
+}
+
+template <class Base>
+grpc::Status AsyncServer::Service<Base>::ProcessBatch(grpc::ServerContext* context,
+	const LunaSDK::ImageBatch* request, LunaSDK::ImageBatchResult* reply) {
+	const CallControl control(context, true);
+	// Every image takes a place in the admission queue.
+	AdmissionQueue::Ticket ticket = admission_.tryEnter(control.lane(), std::max(1, request->images_size()));
+	if (!ticket)
+		return OverloadedStatus();
+	return ProcessImageBatch(pool_, workers_, *request, control, ticket.admitted(), reply);
+}
+
+AsyncServer::AsyncServer(const ServerOptions& options, EstimatorPool& pool, WorkerPool& workers,
+	AdmissionQueue& admission, ResultCache* cache)
+	: options_(options), pool_(pool),
+	  arenas_(static_cast<size_t>(options.arenaInitialKb) * 1024,
+		  static_cast<size_t>(2 * (options.poolSize + options.completionQueues))),
+	  workers_(workers), admission_(admission), cache_(cache) {
+	if (options_.mode == ServerMode::AsyncRaw)
+		rawService_.reset(new RawService(pool, workers, admission));
+	else
+		typedService_.reset(new TypedService(pool, workers, admission));
+}
+
+void AsyncServer::RequestCall(grpc::ServerContext* context, LunaSDK::Image* request,
+	grpc::ServerAsyncResponseWriter<LunaSDK::ImageProccessingResult>* responder,
+	grpc::ServerCompletionQueue* cq, void* tag) {
+	typedService_->RequestProccesing(context, request, responder, cq, cq, tag);
+}
+
+void AsyncServer::RequestCall(grpc::ServerContext* context, grpc::ByteBuffer* request,
+	grpc::ServerAsyncResponseWriter<grpc::ByteBuffer>* responder,
+	grpc::ServerCompletionQueue* cq, void* tag) {
+	rawService_->RequestProccesing(context, request, responder, cq, cq, tag);
+}
+
+grpc::Status AsyncServer::Process(const LunaSDK::Image& request, const CallControl& control,
+	LunaSDK::ImageProccessingResult* reply, google::protobuf::Arena* /*arena*/) {
+	const ImageRequestView view = ViewOf(request);
+	ResultKey cacheKey;
+	const bool cacheable = cache_ != nullptr && cache_->mayHold(view.size);
+	if (cacheable) {
+		cacheKey = ResultCacheKey(view);
+		const ResultCache::Value cached = cache_->find(cacheKey);
+		if (cached && reply->ParseFromString(*cached))
+			return grpc::Status::OK;
+	}
+
+	grpc::Status status;
+	{
+		EstimatorPool::Lease estimators = pool_.acquire(control.deadline(), control.lane());
+		status = ProcessImage(*estimators, view, control, reply);
+	}
+	if (cacheable && status.ok())
+		cache_->insert(cacheKey, reply->SerializeAsString());
+	return status;
+}
+
+grpc::Status AsyncServer::Process(const grpc::ByteBuffer& request, const CallControl& control,
+	grpc::ByteBuffer* reply, google::protobuf::Arena* arena) {
+	RawImageRequest parsed;
+	if (!parsed.parse(request))
+		return grpc::Status(grpc::INVALID_ARGUMENT, "Malformed Image message.");
+
+	// The key points into this parse's image bytes, which stay alive until
+	// the result is stored.
+	ResultKey cacheKey;
+	const bool cacheable = cache_ != nullptr && cache_->mayHold(parsed.view().size);
+	if (cacheable) {
+		cacheKey = ResultCacheKey(parsed.view());
+		const ResultCache::Value cached = cache_->find(cacheKey);
+		if (cached) {
+			// Cached bytes are the serialized reply already.
+			grpc::Slice slice(*cached);
+			*reply = grpc::ByteBuffer(&slice, 1);
+			return grpc::Status::OK;
+		}
+	}
+
+	LunaSDK::ImageProccessingResult* result =
+		google::protobuf::Arena::CreateMessage<LunaSDK::ImageProccessingResult>(arena);
+	grpc::Status status;
+	{
+		EstimatorPool::Lease estimators = pool_.acquire(control.deadline(), control.lane());
+		status = ProcessImage(*estimators, parsed.view(), control, result);
+	}
+	if (!status.ok())
+		return status;
+
+	if (cacheable) {
+		// Serialized once for both the reply and the cache.
+		std::string serialized = result->SerializeAsString();
+		grpc::Slice slice(serialized);
+		*reply = grpc::ByteBuffer(&slice, 1);
+		cache_->insert(cacheKey, std::move(serialized));
+		return grpc::Status::OK;
+	}
+	bool ownBuffer = false;
+	return grpc::SerializationTraits<LunaSDK::ImageProccessingResult>::Serialize(*result, reply, &ownBuffer);
+}
+
+AsyncServer::~AsyncServer() {
+	if (server_)
+		server_->Shutdown();
+	// Always shutdown the completion queues after the server.
+	for (const auto& cq : cqs_)
+		cq->Shutdown();
+}
+
+void AsyncServer::Run() {
+	grpc::ServerBuilder builder;
+	builder.AddListeningPort(options_.address, grpc::InsecureServerCredentials());
+	if (rawService_)
+		builder.RegisterService(rawService_.get());
+	else
+		builder.RegisterService(typedService_.get());
+	for (int i = 0; i < options_.completionQueues; ++i)
+		cqs_.push_back(builder.AddCompletionQueue());
+	server_ = builder.BuildAndStart();
+	LUNA_LOG(Info) << (rawService_ ? "Raw async" : "Async") << " server listening on " << options_.address << " with "
+		<< cqs_.size() << " completion queue(s) and "
+		<< pool_.size() << " worker(s)";
+
+	std::vector<std::thread> pollers;
+	for (const auto& cq : cqs_)
+		pollers.emplace_back(&AsyncServer::HandleRpcs, this, cq.get());
+	for (std::thread& poller : pollers)
+		poller.join();
+}
+
+void AsyncServer::HandleRpcs(grpc::ServerCompletionQueue* cq) {
+	if (rawService_)
+		new CallData<grpc::ByteBuffer, grpc::ByteBuffer>(this, cq);
+	else
+		new CallData<LunaSDK::Image, LunaSDK::ImageProccessingResult>(this, cq);
+	void* tag;
+	bool ok;
+	while (cq->Next(&tag, &ok))
+		static_cast<Call*>(tag)->Proceed(ok);
+}
@@ -0,0 +1,97 @@
+#ifndef LUNAAPI_ASYNC_SERVER_H
+#define LUNAAPI_ASYNC_SERVER_H
+
+#include <memory>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "admission_queue.h"
+#include "arena_pool.h"
+#include "call_control.h"
+#include "estimator_pool.h"
+#include "result_cache.h"
+#include "server_options.h"
+#include "test_api.grpc.pb.h"
+#include "worker_pool.h"
+
+// Completion-queue based server. Each queue is polled by its own thread that
+// only moves calls through their states; the SDK work runs on a separate
+// worker pool sized to the estimator pool, so slow inference never holds up
+// accepting or finishing other calls.
+class AsyncServer {
+ public:
+	// cache may be null.
+	AsyncServer(const ServerOptions& options, EstimatorPool& pool, WorkerPool& workers,
+		AdmissionQueue& admission, ResultCache* cache);
+	~AsyncServer();
+
+	// Starts listening and blocks until the server is shut down.
+	void Run();
+
+ private:
+	// Completion queue tag of an in-flight call.
+	class Call {
+	 public:
+		virtual ~Call() {}
+		virtual void Proceed(bool ok) = 0;
+	};
+
+	template <class Request, class Reply>
+	class CallData;
+
+	// Proccesing is served through the completion queues. Streams hold an
+	// estimator set for their whole lifetime and batches already fan out
+	// to the workers, so both stay on the sync handler threads.
+	template <class Base>
+	class Service final : public Base {
+	 public:
+		Service(EstimatorPool& pool, WorkerPool& workers, AdmissionQueue& admission)
+			: pool_(pool), workers_(workers), admission_(admission) {}
+
+		grpc::Status ProcessStream(grpc::ServerContext* context,
+			grpc::ServerReaderWriter<LunaSDK::ImageProccessingResult, LunaSDK::Image>* stream) override;
+		grpc::Status ProcessBatch(grpc::ServerContext* context, const LunaSDK::ImageBatch* request,
+			LunaSDK::ImageBatchResult* reply) override;
+
+	 private:
+		EstimatorPool& pool_;
+		WorkerPool& workers_;
+		AdmissionQueue& admission_;
+	};
+
+	// Proccesing requests parsed into LunaSDK::Image by gRPC.
+	typedef Service<LunaSDK::LunaSDKServer::WithAsyncMethod_Proccesing<LunaSDK::LunaSDKServer::Service>> TypedService;
+	// Proccesing requests left as received bytes (ServerMode::AsyncRaw).
+	typedef Service<LunaSDK::LunaSDKServer::WithRawMethod_Proccesing<LunaSDK::LunaSDKServer::Service>> RawService;
+
+	void RequestCall(grpc::ServerContext* context, LunaSDK::Image* request,
+		grpc::ServerAsyncResponseWriter<LunaSDK::ImageProccessingResult>* responder,
+		grpc::ServerCompletionQueue* cq, void* tag);
+	void RequestCall(grpc::ServerContext* context, grpc::ByteBuffer* request,
+		grpc::ServerAsyncResponseWriter<grpc::ByteBuffer>* responder,
+		grpc::ServerCompletionQueue* cq, void* tag);
+
+	// Runs on a worker thread. arena is the one the call's messages live on.
+	// Repeated images are answered from the result cache, looked up with
+	// the same parse the processing uses; new results are stored in it.
+	grpc::Status Process(const LunaSDK::Image& request, const CallControl& control,
+		LunaSDK::ImageProccessingResult* reply, google::protobuf::Arena* arena);
+	grpc::Status Process(const grpc::ByteBuffer& request, const CallControl& control,
+		grpc::ByteBuffer* reply, google::protobuf::Arena* arena);
+
+	void HandleRpcs(grpc::ServerCompletionQueue* cq);
+
+	const ServerOptions& options_;
+	EstimatorPool& pool_;
+	ArenaPool arenas_;
+	std::unique_ptr<TypedService> typedService_;
+	std::unique_ptr<RawService> rawService_;
+	std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> cqs_;
+	std::unique_ptr<grpc::Server> server_;
+	WorkerPool& workers_;
+	AdmissionQueue& admission_;
+	ResultCache* cache_;
+};
+
+#endif  // LUNAAPI_ASYNC_SERVER_H
@@ -0,0 +1,49 @@
+#include "batch_estimators.h"
+
+bool EstimateAttributes(fsdk::IAttributeEstimator* estimator, const fsdk::Image* warps, int count,
+	fsdk::AttributeEstimation* results, std::string* error) {
+	for (int i = 0; i < count; ++i) {
+		fsdk::Result<fsdk::FSDKError> result = estimator->estimate(warps[i], results[i]);
+		if (result.isError()) {
+			*error = result.what();
+			return false;
+		}
+	}
+	return true;
+}
+
+bool EstimateQuality(fsdk::IQualityEstimator* estimator, const fsdk::Image* warps, int count,
+	fsdk::Quality* results, std::string* error) {
+	for (int i = 0; i < count; ++i) {
+		fsdk::Result<fsdk::FSDKError> result = estimator->estimate(warps[i], results[i]);
+		if (result.isError()) {
+			*error = result.what();
+			return false;
+		}
+	}
+	return true;
+}
+
+bool EstimateHeadPose(fsdk::IHeadPoseEstimator* estimator, const fsdk::Image& image,
+	const fsdk::Detection* detections, int count, fsdk::HeadPoseEstimation* results, std::string* error) {
+	for (int i = 0; i < count; ++i) {
+		fsdk::Result<fsdk::FSDKError> result = estimator->estimate(image, detections[i], results[i]);
+		if (result.isError()) {
+			*error = result.what();
+			return false;
+		}
+	}
+	return true;
+}
+
+bool EstimateOverlap(fsdk::IOverlapEstimator* estimator, const fsdk::Image& image,
+	const fsdk::Detection* detections, int count, fsdk::OverlapEstimation* results, std::string* error) {
+	for (int i = 0; i < count; ++i) {
+		fsdk::Result<fsdk::FSDKError> result = estimator->estimate(image, detections[i], results[i]);
+		if (result.isError()) {
+			*error = result.what();
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,26 @@
+#ifndef LUNAAPI_BATCH_ESTIMATORS_H
+#define LUNAAPI_BATCH_ESTIMATORS_H
+
+#include <string>
+
+#include <fsdk/FaceEngine.h>
+
+// Estimators applied to count consecutive faces at once. Running one
+// estimator over all faces before the next keeps its model hot in cache,
+// where cycling through every estimator per face would evict it. The SDK
+// only estimates a single face per call, so these loop over the batch.
+// Each returns false with the SDK reason in error if any face fails.
+
+bool EstimateAttributes(fsdk::IAttributeEstimator* estimator, const fsdk::Image* warps, int count,
+	fsdk::AttributeEstimation* results, std::string* error);
+
+bool EstimateQuality(fsdk::IQualityEstimator* estimator, const fsdk::Image* warps, int count,
+	fsdk::Quality* results, std::string* error);
+
+bool EstimateHeadPose(fsdk::IHeadPoseEstimator* estimator, const fsdk::Image& image,
+	const fsdk::Detection* detections, int count, fsdk::HeadPoseEstimation* results, std::string* error);
+
+bool EstimateOverlap(fsdk::IOverlapEstimator* estimator, const fsdk::Image& image,
+	const fsdk::Detection* detections, int count, fsdk::OverlapEstimation* results, std::string* error);
+
+#endif  // LUNAAPI_BATCH_ESTIMATORS_H
@@ -0,0 +1,79 @@
+#ifndef LUNAAPI_BOUNDED_QUEUE_H
+#define LUNAAPI_BOUNDED_QUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+// Blocking FIFO with a fixed capacity, used to hand work between threads.
+// close() wakes everybody up: push() then fails and pop() drains what is
+// left before failing.
+template <class T>
+class BoundedQueue {
+ public:
+	explicit BoundedQueue(size_t capacity) : capacity_(capacity > 0 ? capacity : 1) {}
+
+	// Waits for room. Returns false if the queue was closed.
+	bool push(T value) {
+		std::unique_lock<std::mutex> lock(mutex_);
+		notFull_.wait(lock, [this] { return closed_ || items_.size() < capacity_; });
+		if (closed_)
+			return false;
+		items_.push_back(std::move(value));
+		lock.unlock();
+		notEmpty_.notify_one();
+		return true;
+	}
+
+	// Returns false instead of waiting when the queue is full or closed.
+	bool tryPush(T value) {
+		std::unique_lock<std::mutex> lock(mutex_);
+		if (closed_ || items_.size() >= capacity_)
+			return false;
+		items_.push_back(std::move(value));
+		lock.unlock();
+		notEmpty_.notify_one();
+		return true;
+	}
+
+	// Waits for an item. Returns false once the queue is closed and empty.
+	bool pop(T* value) {
+		std::unique_lock<std::mutex> lock(mutex_);
+		notEmpty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+		if (items_.empty())
+			return false;
+		*value = std::move(items_.front());
+		items_.pop_front();
+		lock.unlock();
+		notFull_.notify_one();
+		return true;
+	}
+
+	void close() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			closed_ = true;
+		}
+		notEmpty_.notify_all();
+		notFull_.notify_all();
+	}
+
+	size_t size() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return items_.size();
+	}
+
+ private:
+	BoundedQueue(const BoundedQueue&) = delete;
+	BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+	const size_t capacity_;
+	mutable std::mutex mutex_;
+	std::condition_variable notEmpty_;
+	std::condition_variable notFull_;
+	std::deque<T> items_;
+	bool closed_ = false;
+};
+
+#endif  // LUNAAPI_BOUNDED_QUEUE_H
@@ -0,0 +1,32 @@
+#include "call_control.h"
+
+CallControl::CallControl(const grpc::ServerContext* context, bool watchCancellation)
+	: context_(watchCancellation ? context : nullptr), lane_(LaneOf(context)) {
+	// gRPC reports the deadline on the system clock; move it to the steady
+	// clock once so later checks are immune to clock changes.
+	const std::chrono::system_clock::time_point deadline = context->deadline();
+	if (deadline == std::chrono::system_clock::time_point::max())
+		return;
+	const std::chrono::system_clock::duration left = deadline - std::chrono::system_clock::now();
+	deadline_ = Clock::now() + std::chrono::duration_cast<Clock::duration>(left);
+}
+
+bool CallControl::canRun(metrics::Stage stage, unsigned pipeline) const {
+	if (context_ != nullptr && context_->IsCancelled())
+		return false;
+	if (deadline_ == Clock::time_point::max())
+		return true;
+	std::chrono::microseconds needed(0);
+	for (int next = static_cast<int>(stage); next < static_cast<int>(metrics::Stage::Count); ++next) {
+		if (pipeline & StageBit(static_cast<metrics::Stage>(next)))
+			needed += metrics::TypicalStageLatency(static_cast<metrics::Stage>(next));
+	}
+	return Clock::now() + needed <= deadline_;
+}
+
+grpc::Status CallControl::stopStatus() const {
+	metrics::CountAbandoned();
+	if (context_ != nullptr && context_->IsCancelled())
+		return grpc::Status(grpc::CANCELLED, "Call cancelled by the client.");
+	return grpc::Status(grpc::DEADLINE_EXCEEDED, "Deadline cannot be met.");
+}
@@ -0,0 +1,56 @@
+#ifndef LUNAAPI_CALL_CONTROL_H
+#define LUNAAPI_CALL_CONTROL_H
+
+#include <chrono>
+
+#include <grpcpp/grpcpp.h>
+
+#include "metrics.h"
+#include "priority_lanes.h"
+
+// Bit of stage in the stage sets CallControl::canRun() takes.
+inline unsigned StageBit(metrics::Stage stage) {
+	return 1u << static_cast<int>(stage);
+}
+
+// Deadline and cancellation of the call an image belongs to. The pipeline
+// checks it before each stage, so work for clients that gave up or can no
+// longer be answered in time is dropped instead of competing with live
+// calls.
+class CallControl {
+ public:
+	typedef std::chrono::steady_clock Clock;
+
+	// No deadline and never cancelled.
+	CallControl() = default;
+
+	// Takes the deadline and lane of context. Cancellation is only watched when
+	// watchCancellation is set: async calls may not query it without
+	// AsyncNotifyWhenDone, so they rely on the deadline alone.
+	CallControl(const grpc::ServerContext* context, bool watchCancellation);
+
+	// A deadline alone, for work that does not come from a gRPC call.
+	explicit CallControl(Clock::time_point deadline) : deadline_(deadline) {}
+
+	// Clock::time_point::max() when the client set none.
+	Clock::time_point deadline() const { return deadline_; }
+
+	Lane lane() const { return lane_; }
+
+	// False once the client cancelled, or when the time left is below the
+	// summed median latencies of the stages in pipeline from stage on, so
+	// work that could not be answered in time is not started. pipeline
+	// holds the StageBit() of each stage the call runs; stages run in
+	// metrics::Stage order, and stage itself only counts when in pipeline.
+	bool canRun(metrics::Stage stage, unsigned pipeline) const;
+
+	// CANCELLED or DEADLINE_EXCEEDED, for a call canRun() turned down.
+	grpc::Status stopStatus() const;
+
+ private:
+	const grpc::ServerContext* context_ = nullptr;
+	Clock::time_point deadline_ = Clock::time_point::max();
+	Lane lane_ = Lane::Interactive;
+};
+
+#endif  // LUNAAPI_CALL_CONTROL_H
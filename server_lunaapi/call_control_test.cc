@@ -0,0 +1,52 @@
+// Checks the deadline arithmetic of CallControl::canRun(): only the stages
+// a call runs count towards the time it needs, so a detection-only call
+// with a tight deadline is not stopped for a warp it never does.
+
+#include <chrono>
+#include <cstdio>
+
+#include "call_control.h"
+
+namespace {
+
+int failures = 0;
+
+void Expect(bool condition, const char* what) {
+	if (!condition) {
+		std::printf("FAIL %s\n", what);
+		++failures;
+	}
+}
+
+}  // namespace
+
+int main() {
+	// Typical latencies: detection 1 ms, warp 50 ms.
+	for (int i = 0; i < 100; ++i) {
+		metrics::RecordStage(metrics::Stage::Detect, std::chrono::milliseconds(1));
+		metrics::RecordStage(metrics::Stage::Warp, std::chrono::milliseconds(50));
+	}
+
+	const unsigned detectOnly = StageBit(metrics::Stage::ImageLoad) | StageBit(metrics::Stage::Detect);
+	const unsigned withWarp = detectOnly | StageBit(metrics::Stage::Warp);
+
+	// Time for detection, not for a warp.
+	const CallControl tight(CallControl::Clock::now() + std::chrono::milliseconds(20));
+	Expect(tight.canRun(metrics::Stage::ImageLoad, detectOnly), "detection-only call stopped before loading");
+	Expect(tight.canRun(metrics::Stage::Detect, detectOnly), "detection-only call stopped before detection");
+	Expect(tight.canRun(metrics::Stage::Warp, detectOnly), "detection-only call charged for the warp it skips");
+	Expect(!tight.canRun(metrics::Stage::Detect, withWarp), "call needing a 50 ms warp started with 20 ms left");
+	Expect(!tight.canRun(metrics::Stage::Warp, withWarp), "50 ms warp started with 20 ms left");
+
+	const CallControl loose(CallControl::Clock::now() + std::chrono::seconds(10));
+	Expect(loose.canRun(metrics::Stage::Detect, withWarp), "call stopped with ample time left");
+
+	const CallControl expired(CallControl::Clock::now() - std::chrono::milliseconds(1));
+	Expect(!expired.canRun(metrics::Stage::Detect, detectOnly), "call started past its deadline");
+
+	const CallControl unlimited;
+	Expect(unlimited.canRun(metrics::Stage::Detect, withWarp), "call without a deadline stopped");
+
+	std::printf("%d failure(s)\n", failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+#include "color_convert.h"
+
+#include <cstring>
+
+#include "color_convert_kernels.h"
+
+namespace color_kernels {
+namespace {
+
+uint8_t Clamp(int value) {
+	return static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+void YuvToRgb(int y, int u, int v, uint8_t* rgb) {
+	const int c = YuvY * (y - 16);
+	const int d = u - 128;
+	const int e = v - 128;
+	rgb[0] = Clamp((c + YuvRv * e + YuvRound) >> YuvShift);
+	rgb[1] = Clamp((c + YuvGu * d + YuvGv * e + YuvRound) >> YuvShift);
+	rgb[2] = Clamp((c + YuvBu * d + YuvRound) >> YuvShift);
+}
+
+void BgrRow(const uint8_t* src, int width, uint8_t* dst) {
+	for (int x = 0; x < width; ++x, src += 3, dst += 3) {
+		dst[0] = src[2];
+		dst[1] = src[1];
+		dst[2] = src[0];
+	}
+}
+
+void RgbaRow(const uint8_t* src, int width, uint8_t* dst) {
+	for (int x = 0; x < width; ++x, src += 4, dst += 3) {
+		dst[0] = src[0];
+		dst[1] = src[1];
+		dst[2] = src[2];
+	}
+}
+
+void GrayRow(const uint8_t* src, int width, uint8_t* dst) {
+	for (int x = 0; x < width; ++x, dst += 3)
+		dst[0] = dst[1] = dst[2] = src[x];
+}
+
+void Nv12Row(const uint8_t* y, const uint8_t* uv, int width, uint8_t* dst) {
+	for (int x = 0; x < width; ++x, dst += 3) {
+		const int c = (x >> 1) * 2;
+		YuvToRgb(y[x], uv[c], uv[c + 1], dst);
+	}
+}
+
+void Yuv420Row(const uint8_t* y, const uint8_t* u, const uint8_t* v, int width, uint8_t* dst) {
+	for (int x = 0; x < width; ++x, dst += 3)
+		YuvToRgb(y[x], u[x >> 1], v[x >> 1], dst);
+}
+
+}  // namespace
+
+const RowKernels Scalar = { BgrRow, RgbaRow, GrayRow, Nv12Row, Yuv420Row };
+
+}  // namespace color_kernels
+
+namespace {
+
+size_t ChromaStride(int stride) {
+	return (static_cast<size_t>(stride) + 1) / 2;
+}
+
+int ChromaRows(int height) {
+	return height / 2 + height % 2;
+}
+
+const color_kernels::RowKernels& KernelsFor(SimdLevel level) {
+	if (level == SimdLevel::Avx2 && color_kernels::Avx2 != nullptr)
+		return *color_kernels::Avx2;
+	if (level >= SimdLevel::Sse42 && color_kernels::Sse42 != nullptr)
+		return *color_kernels::Sse42;
+	return color_kernels::Scalar;
+}
+
+}  // namespace
+
+bool ParsePixelLayout(const char* name, PixelLayout* layout) {
+	static const struct {
+		const char* name;
+		PixelLayout layout;
+	} names[] = {
+		{ "rgb", PixelLayout::Rgb },
+		{ "bgr", PixelLayout::Bgr },
+		{ "rgba", PixelLayout::Rgba },
+		{ "gray", PixelLayout::Gray },
+		{ "nv12", PixelLayout::Nv12 },
+		{ "yuv420", PixelLayout::Yuv420 },
+	};
+	for (const auto& entry : names) {
+		if (std::strcmp(name, entry.name) == 0) {
+			*layout = entry.layout;
+			return true;
+		}
+	}
+	return false;
+}
+
+size_t MinRowStride(PixelLayout layout, int width) {
+	switch (layout) {
+	case PixelLayout::Rgb:
+	case PixelLayout::Bgr:
+		return static_cast<size_t>(width) * 3;
+	case PixelLayout::Rgba:
+		return static_cast<size_t>(width) * 4;
+	case PixelLayout::Gray:
+	case PixelLayout::Nv12:
+	case PixelLayout::Yuv420:
+		return width;
+	}
+	return 0;
+}
+
+size_t FrameBytes(PixelLayout layout, int width, int height, int stride) {
+	if (width <= 0 || height <= 0 || stride <= 0)
+		return 0;
+	const size_t chromaRows = ChromaRows(height);
+	const size_t chromaWidth = (static_cast<size_t>(width) + 1) / 2;
+	switch (layout) {
+	case PixelLayout::Nv12:
+		// Interleaved U/V rows are as long as the luma rows.
+		return static_cast<size_t>(stride) * height +
+			static_cast<size_t>(stride) * (chromaRows - 1) + chromaWidth * 2;
+	case PixelLayout::Yuv420: {
+		const size_t chromaPlane = ChromaStride(stride) * chromaRows;
+		return static_cast<size_t>(stride) * height + chromaPlane +
+			ChromaStride(stride) * (chromaRows - 1) + chromaWidth;
+	}
+	default:
+		return static_cast<size_t>(stride) * (height - 1) + MinRowStride(layout, width);
+	}
+}
+
+SimdLevel DetectSimdLevel() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	static const SimdLevel level = [] {
+		__builtin_cpu_init();
+		if (color_kernels::Avx2 != nullptr && __builtin_cpu_supports("avx2"))
+			return SimdLevel::Avx2;
+		if (color_kernels::Sse42 != nullptr && __builtin_cpu_supports("sse4.2"))
+			return SimdLevel::Sse42;
+		return SimdLevel::Scalar;
+	}();
+	return level;
+#else
+	return SimdLevel::Scalar;
+#endif
+}
+
+const char* SimdLevelName(SimdLevel level) {
+	switch (level) {
+	case SimdLevel::Scalar: return "scalar";
+	case SimdLevel::Sse42: return "SSE4.2";
+	case SimdLevel::Avx2: return "AVX2";
+	}
+	return "unknown";
+}
+
+void ConvertToRgb(PixelLayout layout, const uint8_t* src, int width, int height, int stride,
+	uint8_t* dst, int dstStride) {
+	ConvertToRgb(layout, src, width, height, stride, dst, dstStride, DetectSimdLevel());
+}
+
+void ConvertToRgb(PixelLayout layout, const uint8_t* src, int width, int height, int stride,
+	uint8_t* dst, int dstStride, SimdLevel level) {
+	const color_kernels::RowKernels& kernels = KernelsFor(level);
+	const uint8_t* chroma = src + static_cast<size_t>(stride) * height;
+	const size_t chromaStride = ChromaStride(stride);
+	for (int row = 0; row < height; ++row) {
+		const uint8_t* in = src + static_cast<size_t>(stride) * row;
+		uint8_t* out = dst + static_cast<size_t>(dstStride) * row;
+		switch (layout) {
+		case PixelLayout::Rgb:
+			std::memcpy(out, in, static_cast<size_t>(width) * 3);
+			break;
+		case PixelLayout::Bgr: kernels.bgr(in, width, out); break;
+		case PixelLayout::Rgba: kernels.rgba(in, width, out); break;
+		case PixelLayout::Gray: kernels.gray(in, width, out); break;
+		case PixelLayout::Nv12:
+			kernels.nv12(in, chroma + static_cast<size_t>(stride) * (row >> 1), width, out);
+			break;
+		case PixelLayout::Yuv420: {
+			const uint8_t* u = chroma + chromaStride * (row >> 1);
+			const uint8_t* v = chroma + chromaStride * ChromaRows(height) + chromaStride * (row >> 1);
+			kernels.yuv420(in, u, v, width, out);
+			break;
+		}
+		}
+	}
+}
@@ -0,0 +1,57 @@
+#ifndef LUNAAPI_COLOR_CONVERT_H
+#define LUNAAPI_COLOR_CONVERT_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Uncompressed pixel layouts accepted from clients.
+enum class PixelLayout {
+	Rgb,
+	Bgr,
+	Rgba,
+	Gray,
+	// Y plane followed by interleaved U/V at half resolution.
+	Nv12,
+	// Y, U and V planes (I420); chroma rows are (stride + 1) / 2 bytes apart.
+	Yuv420,
+};
+
+// Instruction sets with conversion kernels, slowest first.
+enum class SimdLevel {
+	Scalar,
+	Sse42,
+	Avx2,
+};
+
+// Parses rgb, bgr, rgba, gray, nv12 or yuv420.
+bool ParsePixelLayout(const char* name, PixelLayout* layout);
+
+// Longest frame side accepted from clients, and the widest row stride:
+// four bytes a pixel across it. Frames within both keep every size below
+// in range of int.
+const int MaxFrameSide = 16384;
+const int MaxRowStride = 4 * MaxFrameSide;
+
+// Smallest row stride of the layout's first plane.
+size_t MinRowStride(PixelLayout layout, int width);
+
+// Bytes a frame of the given size occupies, stride included. The last row
+// of each plane does not need its padding.
+size_t FrameBytes(PixelLayout layout, int width, int height, int stride);
+
+// Best level supported by both the build and the running CPU.
+SimdLevel DetectSimdLevel();
+const char* SimdLevelName(SimdLevel level);
+
+// Converts a frame to packed 8-bit RGB rows dstStride bytes apart. YUV
+// input is BT.601 limited range, as produced by camera encoders. Uses the
+// DetectSimdLevel() kernels; every level gives bit-identical output.
+void ConvertToRgb(PixelLayout layout, const uint8_t* src, int width, int height, int stride,
+	uint8_t* dst, int dstStride);
+
+// Same with the kernels of an explicit level, which must not exceed
+// DetectSimdLevel().
+void ConvertToRgb(PixelLayout layout, const uint8_t* src, int width, int height, int stride,
+	uint8_t* dst, int dstStride, SimdLevel level);
+
+#endif  // LUNAAPI_COLOR_CONVERT_H
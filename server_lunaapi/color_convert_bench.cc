@@ -0,0 +1,63 @@
+// Throughput of the color conversion kernels of every supported level on
+// a 1080p frame of each layout.
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "color_convert.h"
+
+namespace {
+
+const PixelLayout Layouts[] = {
+	PixelLayout::Rgb, PixelLayout::Bgr, PixelLayout::Rgba,
+	PixelLayout::Gray, PixelLayout::Nv12, PixelLayout::Yuv420,
+};
+const char* const LayoutNames[] = { "rgb", "bgr", "rgba", "gray", "nv12", "yuv420" };
+
+const SimdLevel Levels[] = { SimdLevel::Scalar, SimdLevel::Sse42, SimdLevel::Avx2 };
+
+const int Width = 1920;
+const int Height = 1080;
+
+// Minimum time spent converting per layout and level.
+const std::chrono::milliseconds MinDuration(300);
+
+}  // namespace
+
+int main() {
+	const SimdLevel best = DetectSimdLevel();
+	std::mt19937 random(1234);
+	std::vector<uint8_t> dst(static_cast<size_t>(Width) * 3 * Height);
+
+	std::printf("%-8s %-8s %12s %12s\n", "layout", "level", "Mpixel/s", "frames/s");
+	for (size_t l = 0; l < sizeof(Layouts) / sizeof(Layouts[0]); ++l) {
+		const PixelLayout layout = Layouts[l];
+		const int stride = static_cast<int>(MinRowStride(layout, Width));
+		std::vector<uint8_t> frame(FrameBytes(layout, Width, Height, stride));
+		for (uint8_t& byte : frame)
+			byte = static_cast<uint8_t>(random());
+
+		for (SimdLevel level : Levels) {
+			if (level > best)
+				continue;
+			// Warm the caches and page in the destination.
+			ConvertToRgb(layout, frame.data(), Width, Height, stride, dst.data(), Width * 3, level);
+
+			int frames = 0;
+			const auto start = std::chrono::steady_clock::now();
+			std::chrono::steady_clock::duration elapsed;
+			do {
+				ConvertToRgb(layout, frame.data(), Width, Height, stride, dst.data(), Width * 3, level);
+				++frames;
+				elapsed = std::chrono::steady_clock::now() - start;
+			} while (elapsed < MinDuration);
+
+			const double seconds = std::chrono::duration<double>(elapsed).count();
+			std::printf("%-8s %-8s %12.1f %12.1f\n", LayoutNames[l], SimdLevelName(level),
+				frames * static_cast<double>(Width) * Height / seconds / 1e6, frames / seconds);
+		}
+	}
+	return 0;
+}
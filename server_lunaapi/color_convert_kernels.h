@@ -0,0 +1,43 @@
+#ifndef LUNAAPI_COLOR_CONVERT_KERNELS_H
+#define LUNAAPI_COLOR_CONVERT_KERNELS_H
+
+#include <cstdint>
+
+// Row converters behind ConvertToRgb, one table per instruction set. Each
+// writes width packed RGB pixels to dst. Vector kernels hand the last
+// pixels of a row that do not fill a register to the scalar ones, so all
+// tables produce identical output.
+namespace color_kernels {
+
+struct RowKernels {
+	void (*bgr)(const uint8_t* src, int width, uint8_t* dst);
+	void (*rgba)(const uint8_t* src, int width, uint8_t* dst);
+	void (*gray)(const uint8_t* src, int width, uint8_t* dst);
+	void (*nv12)(const uint8_t* y, const uint8_t* uv, int width, uint8_t* dst);
+	void (*yuv420)(const uint8_t* y, const uint8_t* u, const uint8_t* v, int width, uint8_t* dst);
+};
+
+// Reference implementation; always available.
+extern const RowKernels Scalar;
+
+// Null when the build target has no x86 vector support.
+extern const RowKernels* const Sse42;
+extern const RowKernels* const Avx2;
+
+// BT.601 limited range in 6-bit fixed point, the precision at which every
+// intermediate fits in int16 and vector kernels work on 16-bit lanes.
+// Only the blue sum can pass 32767; kernels saturate it, which still
+// clamps to 255 exactly like the scalar code.
+enum {
+	YuvY = 74,
+	YuvRv = 102,
+	YuvGu = -25,
+	YuvGv = -52,
+	YuvBu = 129,
+	YuvRound = 32,
+	YuvShift = 6,
+};
+
+}  // namespace color_kernels
+
+#endif  // LUNAAPI_COLOR_CONVERT_KERNELS_H
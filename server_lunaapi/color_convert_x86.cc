@@ -0,0 +1,232 @@
+#include "color_convert_kernels.h"
+
+// SSE4.2 and AVX2 row kernels. They are compiled with per-function target
+// attributes rather than global -m flags, so the rest of the binary still
+// runs on any x86-64 and DetectSimdLevel() picks a table at run time.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <immintrin.h>
+
+#define LUNA_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define LUNA_TARGET_AVX2 __attribute__((target("avx2")))
+#define LUNA_INLINE inline __attribute__((always_inline))
+
+namespace color_kernels {
+namespace {
+
+// --- SSE4.2: 16 pixels per step. ---
+
+// Spreads planar r, g and b bytes of 16 pixels over 48 packed RGB bytes.
+LUNA_TARGET_SSE42 LUNA_INLINE void StoreRgb16(__m128i r, __m128i g, __m128i b, uint8_t* dst) {
+	const __m128i r0 = _mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5);
+	const __m128i r1 = _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1);
+	const __m128i r2 = _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1);
+	const __m128i g0 = _mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1);
+	const __m128i g1 = _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10);
+	const __m128i g2 = _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1);
+	const __m128i b0 = _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1);
+	const __m128i b1 = _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1);
+	const __m128i b2 = _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15);
+	__m128i* out = reinterpret_cast<__m128i*>(dst);
+	_mm_storeu_si128(out, _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(r, r0), _mm_shuffle_epi8(g, g0)),
+		_mm_shuffle_epi8(b, b0)));
+	_mm_storeu_si128(out + 1, _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(r, r1), _mm_shuffle_epi8(g, g1)),
+		_mm_shuffle_epi8(b, b1)));
+	_mm_storeu_si128(out + 2, _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(r, r2), _mm_shuffle_epi8(g, g2)),
+		_mm_shuffle_epi8(b, b2)));
+}
+
+// Converts 16 pixels; u and v hold one sample per pixel pair in their low
+// 8 bytes. The terms fit in int16 (see YuvY), so all arithmetic is 16-bit.
+LUNA_TARGET_SSE42 LUNA_INLINE void YuvToRgb16(__m128i y, __m128i u, __m128i v, uint8_t* dst) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i lumaOffset = _mm_set1_epi16(16);
+	const __m128i chromaOffset = _mm_set1_epi16(128);
+	const __m128i round = _mm_set1_epi16(YuvRound);
+
+	u = _mm_unpacklo_epi8(u, u);
+	v = _mm_unpacklo_epi8(v, v);
+	__m128i r[2], g[2], b[2];
+	for (int half = 0; half < 2; ++half) {
+		const __m128i luma = half == 0 ? _mm_unpacklo_epi8(y, zero) : _mm_unpackhi_epi8(y, zero);
+		const __m128i cu = half == 0 ? _mm_unpacklo_epi8(u, zero) : _mm_unpackhi_epi8(u, zero);
+		const __m128i cv = half == 0 ? _mm_unpacklo_epi8(v, zero) : _mm_unpackhi_epi8(v, zero);
+		const __m128i c = _mm_add_epi16(_mm_mullo_epi16(_mm_sub_epi16(luma, lumaOffset), _mm_set1_epi16(YuvY)), round);
+		const __m128i d = _mm_sub_epi16(cu, chromaOffset);
+		const __m128i e = _mm_sub_epi16(cv, chromaOffset);
+		r[half] = _mm_srai_epi16(_mm_adds_epi16(c, _mm_mullo_epi16(e, _mm_set1_epi16(YuvRv))), YuvShift);
+		g[half] = _mm_srai_epi16(_mm_adds_epi16(c, _mm_add_epi16(_mm_mullo_epi16(d, _mm_set1_epi16(YuvGu)),
+			_mm_mullo_epi16(e, _mm_set1_epi16(YuvGv)))), YuvShift);
+		b[half] = _mm_srai_epi16(_mm_adds_epi16(c, _mm_mullo_epi16(d, _mm_set1_epi16(YuvBu))), YuvShift);
+	}
+	StoreRgb16(_mm_packus_epi16(r[0], r[1]), _mm_packus_epi16(g[0], g[1]), _mm_packus_epi16(b[0], b[1]), dst);
+}
+
+LUNA_TARGET_SSE42 void BgrRowSse42(const uint8_t* src, int width, uint8_t* dst) {
+	const __m128i swap = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+	int x = 0;
+	// 5 pixels per step; the 16th byte is rewritten by the next step, and
+	// the loop stops while a full register still fits in both rows.
+	for (; x + 6 <= width; x += 5) {
+		const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * x));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * x), _mm_shuffle_epi8(pixels, swap));
+	}
+	Scalar.bgr(src + 3 * x, width - x, dst + 3 * x);
+}
+
+LUNA_TARGET_SSE42 void RgbaRowSse42(const uint8_t* src, int width, uint8_t* dst) {
+	const __m128i pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+	int x = 0;
+	// 4 pixels per step; the store overruns by 4 bytes, so stop 6 early.
+	for (; x + 6 <= width; x += 4) {
+		const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4 * x));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * x), _mm_shuffle_epi8(pixels, pack));
+	}
+	Scalar.rgba(src + 4 * x, width - x, dst + 3 * x);
+}
+
+LUNA_TARGET_SSE42 void GrayRowSse42(const uint8_t* src, int width, uint8_t* dst) {
+	int x = 0;
+	for (; x + 16 <= width; x += 16) {
+		const __m128i gray = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+		StoreRgb16(gray, gray, gray, dst + 3 * x);
+	}
+	Scalar.gray(src + x, width - x, dst + 3 * x);
+}
+
+LUNA_TARGET_SSE42 void Nv12RowSse42(const uint8_t* y, const uint8_t* uv, int width, uint8_t* dst) {
+	const __m128i evens = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1);
+	const __m128i odds = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, -1, -1, -1, -1, -1, -1, -1, -1);
+	int x = 0;
+	for (; x + 16 <= width; x += 16) {
+		const __m128i luma = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + x));
+		const __m128i chroma = _mm_loadu_si128(reinterpret_cast<const __m128i*>(uv + x));
+		YuvToRgb16(luma, _mm_shuffle_epi8(chroma, evens), _mm_shuffle_epi8(chroma, odds), dst + 3 * x);
+	}
+	Scalar.nv12(y + x, uv + x, width - x, dst + 3 * x);
+}
+
+LUNA_TARGET_SSE42 void Yuv420RowSse42(const uint8_t* y, const uint8_t* u, const uint8_t* v, int width, uint8_t* dst) {
+	int x = 0;
+	for (; x + 16 <= width; x += 16) {
+		const __m128i luma = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + x));
+		const __m128i cu = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + x / 2));
+		const __m128i cv = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + x / 2));
+		YuvToRgb16(luma, cu, cv, dst + 3 * x);
+	}
+	Scalar.yuv420(y + x, u + x / 2, v + x / 2, width - x, dst + 3 * x);
+}
+
+// --- AVX2: 32 pixels per step, remainders go through the SSE4.2 kernels. ---
+
+// Saturates two vectors of 16 in-order int16 pixels to 32 in-order bytes.
+LUNA_TARGET_AVX2 LUNA_INLINE __m256i PackPixels(__m256i first, __m256i second) {
+	return _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xd8);
+}
+
+// Converts 32 pixels; u and v hold one sample per pixel pair.
+LUNA_TARGET_AVX2 LUNA_INLINE void YuvToRgb32(__m256i y, __m128i u, __m128i v, uint8_t* dst) {
+	const __m256i lumaOffset = _mm256_set1_epi16(16);
+	const __m256i chromaOffset = _mm256_set1_epi16(128);
+	const __m256i round = _mm256_set1_epi16(YuvRound);
+
+	const __m128i uPairs[2] = { _mm_unpacklo_epi8(u, u), _mm_unpackhi_epi8(u, u) };
+	const __m128i vPairs[2] = { _mm_unpacklo_epi8(v, v), _mm_unpackhi_epi8(v, v) };
+	const __m128i luma[2] = { _mm256_castsi256_si128(y), _mm256_extracti128_si256(y, 1) };
+	__m256i r[2], g[2], b[2];
+	for (int half = 0; half < 2; ++half) {
+		const __m256i c = _mm256_add_epi16(_mm256_mullo_epi16(
+			_mm256_sub_epi16(_mm256_cvtepu8_epi16(luma[half]), lumaOffset), _mm256_set1_epi16(YuvY)), round);
+		const __m256i d = _mm256_sub_epi16(_mm256_cvtepu8_epi16(uPairs[half]), chromaOffset);
+		const __m256i e = _mm256_sub_epi16(_mm256_cvtepu8_epi16(vPairs[half]), chromaOffset);
+		r[half] = _mm256_srai_epi16(_mm256_adds_epi16(c, _mm256_mullo_epi16(e, _mm256_set1_epi16(YuvRv))), YuvShift);
+		g[half] = _mm256_srai_epi16(_mm256_adds_epi16(c, _mm256_add_epi16(_mm256_mullo_epi16(d, _mm256_set1_epi16(YuvGu)),
+			_mm256_mullo_epi16(e, _mm256_set1_epi16(YuvGv)))), YuvShift);
+		b[half] = _mm256_srai_epi16(_mm256_adds_epi16(c, _mm256_mullo_epi16(d, _mm256_set1_epi16(YuvBu))), YuvShift);
+	}
+	const __m256i red = PackPixels(r[0], r[1]);
+	const __m256i green = PackPixels(g[0], g[1]);
+	const __m256i blue = PackPixels(b[0], b[1]);
+	StoreRgb16(_mm256_castsi256_si128(red), _mm256_castsi256_si128(green), _mm256_castsi256_si128(blue), dst);
+	StoreRgb16(_mm256_extracti128_si256(red, 1), _mm256_extracti128_si256(green, 1),
+		_mm256_extracti128_si256(blue, 1), dst + 48);
+}
+
+LUNA_TARGET_AVX2 void BgrRowAvx2(const uint8_t* src, int width, uint8_t* dst) {
+	const __m256i swap = _mm256_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15,
+		2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+	int x = 0;
+	// Two runs of 5 pixels, one per 128-bit lane, 15 bytes apart.
+	for (; x + 11 <= width; x += 10) {
+		const uint8_t* in = src + 3 * x;
+		const __m256i pixels = _mm256_inserti128_si256(
+			_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in))),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 15)), 1);
+		const __m256i swapped = _mm256_shuffle_epi8(pixels, swap);
+		uint8_t* out = dst + 3 * x;
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(swapped));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 15), _mm256_extracti128_si256(swapped, 1));
+	}
+	BgrRowSse42(src + 3 * x, width - x, dst + 3 * x);
+}
+
+LUNA_TARGET_AVX2 void RgbaRowAvx2(const uint8_t* src, int width, uint8_t* dst) {
+	const __m256i pack = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+	const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+	int x = 0;
+	// 8 pixels per step; the store overruns by 8 bytes, so stop 11 early.
+	for (; x + 11 <= width; x += 8) {
+		const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4 * x));
+		const __m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(pixels, pack), compact);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 3 * x), packed);
+	}
+	RgbaRowSse42(src + 4 * x, width - x, dst + 3 * x);
+}
+
+LUNA_TARGET_AVX2 void Nv12RowAvx2(const uint8_t* y, const uint8_t* uv, int width, uint8_t* dst) {
+	const __m256i split = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+		0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+	int x = 0;
+	for (; x + 32 <= width; x += 32) {
+		const __m256i luma = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + x));
+		const __m256i chroma = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(uv + x));
+		// [u0-7 v0-7 | u8-15 v8-15] -> [u0-15 | v0-15]
+		const __m256i planar = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(chroma, split), 0xd8);
+		YuvToRgb32(luma, _mm256_castsi256_si128(planar), _mm256_extracti128_si256(planar, 1), dst + 3 * x);
+	}
+	Nv12RowSse42(y + x, uv + x, width - x, dst + 3 * x);
+}
+
+LUNA_TARGET_AVX2 void Yuv420RowAvx2(const uint8_t* y, const uint8_t* u, const uint8_t* v, int width, uint8_t* dst) {
+	int x = 0;
+	for (; x + 32 <= width; x += 32) {
+		const __m256i luma = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + x));
+		const __m128i cu = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u + x / 2));
+		const __m128i cv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + x / 2));
+		YuvToRgb32(luma, cu, cv, dst + 3 * x);
+	}
+	Yuv420RowSse42(y + x, u + x / 2, v + x / 2, width - x, dst + 3 * x);
+}
+
+const RowKernels Sse42Kernels = { BgrRowSse42, RgbaRowSse42, GrayRowSse42, Nv12RowSse42, Yuv420RowSse42 };
+// Gray expansion is bound by the stores; the SSE4.2 kernel is as fast.
+const RowKernels Avx2Kernels = { BgrRowAvx2, RgbaRowAvx2, GrayRowSse42, Nv12RowAvx2, Yuv420RowAvx2 };
+
+}  // namespace
+
+const RowKernels* const Sse42 = &Sse42Kernels;
+const RowKernels* const Avx2 = &Avx2Kernels;
+
+}  // namespace color_kernels
+
+#else
+
+namespace color_kernels {
+
+const RowKernels* const Sse42 = nullptr;
+const RowKernels* const Avx2 = nullptr;
+
+}  // namespace color_kernels
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef LUNAAPI_COORDINATE_TRANSFORM_H
+#define LUNAAPI_COORDINATE_TRANSFORM_H
+
+#include <cmath>
+
+#include <fsdk/FaceEngine.h>
+
+// Maps coordinates from one resolution of an image to another. Every
+// resolution change in the pipeline (reduced JPEG decode, detection on a
+// pyramid level) goes through one of these, so results always come back
+// in the coordinates of the image the client sent.
+struct CoordinateTransform {
+	// Target pixels per source pixel.
+	float scaleX = 1.f;
+	float scaleY = 1.f;
+
+	bool isIdentity() const { return scaleX == 1.f && scaleY == 1.f; }
+
+	CoordinateTransform inverse() const {
+		CoordinateTransform inverted;
+		inverted.scaleX = 1.f / scaleX;
+		inverted.scaleY = 1.f / scaleY;
+		return inverted;
+	}
+
+	// This transform followed by next.
+	CoordinateTransform then(const CoordinateTransform& next) const {
+		CoordinateTransform combined;
+		combined.scaleX = scaleX * next.scaleX;
+		combined.scaleY = scaleY * next.scaleY;
+		return combined;
+	}
+
+	fsdk::Point2f apply(const fsdk::Point2f& point) const {
+		fsdk::Point2f mapped;
+		mapped.x = point.x * scaleX;
+		mapped.y = point.y * scaleY;
+		return mapped;
+	}
+
+	// Edges are rounded separately so adjacent rectangles stay adjacent.
+	fsdk::Rect apply(const fsdk::Rect& rect) const {
+		const int left = static_cast<int>(std::lround(rect.x * scaleX));
+		const int top = static_cast<int>(std::lround(rect.y * scaleY));
+		const int right = static_cast<int>(std::lround((rect.x + rect.width) * scaleX));
+		const int bottom = static_cast<int>(std::lround((rect.y + rect.height) * scaleY));
+		return fsdk::Rect(left, top, right - left, bottom - top);
+	}
+
+	void apply(fsdk::Detection* detection) const {
+		detection->rect = apply(detection->rect);
+	}
+
+	template <class Landmarks>
+	void apply(Landmarks* landmarks) const {
+		for (int i = 0; i < Landmarks::landmarkCount; ++i)
+			landmarks->landmarks[i] = apply(landmarks->landmarks[i]);
+	}
+};
+
+#endif  // LUNAAPI_COORDINATE_TRANSFORM_H
@@ -0,0 +1,128 @@
+#include "estimator_pool.h"
+
+#include <algorithm>
+
+#include "logger.h"
+
+EstimatorPool::Lease::Lease(Lease&& other) : pool_(other.pool_), set_(other.set_), lane_(other.lane_) {
+	other.pool_ = nullptr;
+	other.set_ = nullptr;
+}
+
+EstimatorPool::Lease::~Lease() {
+	if (pool_ != nullptr)
+		pool_->release(set_, lane_);
+}
+
+bool EstimatorPool::init(const std::string& dataPath, const std::string& configPath, int poolSize) {
+	// Create FaceEngine root SDK object.
+	faceEngine_ = fsdk::acquire(fsdk::createFaceEngine(dataPath.c_str(), configPath.c_str()));
+	if (!faceEngine_) {
+		LUNA_LOG(Error) << "Failed to create face engine instance.";
+		return false;
+	}
+
+	for (int i = 0; i < poolSize; ++i) {
+		std::unique_ptr<EstimatorSet> set(new EstimatorSet());
+		if (!createSet(set.get()))
+			return false;
+		free_.push_back(set.get());
+		sets_.push_back(std::move(set));
+	}
+	setPipelineSettings(PipelineSettings());
+	setLanes(0, 1);
+	return true;
+}
+
+bool EstimatorPool::createSet(EstimatorSet* set) {
+	// Create MTCNN detector.
+	set->faceDetector = fsdk::acquire(faceEngine_->createDetector(fsdk::ODT_MTCNN));
+	if (!set->faceDetector) {
+		LUNA_LOG(Error) << "Failed to create face detector instance.";
+		return false;
+	}
+
+	return CreateFaceEstimators(faceEngine_, set);
+}
+
+bool EstimatorPool::enableFaceParallelism(int threads) {
+	facePool_.reset(new FacePool());
+	if (!facePool_->start(faceEngine_, threads))
+		return false;
+	for (const auto& set : sets_)
+		set->facePool = facePool_.get();
+	return true;
+}
+
+void EstimatorPool::setWarpDumper(WarpDumper* dumper) {
+	for (const auto& set : sets_)
+		set->warpDumper = dumper;
+}
+
+void EstimatorPool::setPipelineSettings(const PipelineSettings& settings) {
+	for (const auto& set : sets_) {
+		set->settings = settings;
+		set->detections.resize(settings.maxFacesLimit);
+		set->landmarks5.resize(settings.maxFacesLimit);
+		set->landmarks68.resize(settings.maxFacesLimit);
+	}
+}
+
+bool EstimatorPool::Later(const Waiter* a, const Waiter* b) {
+	if (a->deadline != b->deadline)
+		return a->deadline > b->deadline;
+	return a->sequence > b->sequence;
+}
+
+void EstimatorPool::setLanes(int reserved, int weight) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	lanes_.reset(new LaneScheduler(size(), reserved, weight));
+}
+
+EstimatorPool::Lease EstimatorPool::acquire() {
+	return acquire(std::chrono::steady_clock::time_point::max(), Lane::Interactive);
+}
+
+EstimatorPool::Lease EstimatorPool::acquire(std::chrono::steady_clock::time_point deadline, Lane lane) {
+	std::unique_lock<std::mutex> lock(mutex_);
+	std::vector<Waiter*>& waiters = waiters_[static_cast<int>(lane)];
+	// Bulk calls do not overtake waiting interactive ones.
+	const bool interactiveWaiting = !waiters_[static_cast<int>(Lane::Interactive)].empty();
+	if (!free_.empty() && waiters.empty() && lanes_->mayStart(lane) &&
+		(lane == Lane::Interactive || !interactiveWaiting)) {
+		lanes_->started(lane);
+		EstimatorSet* set = free_.back();
+		free_.pop_back();
+		return Lease(this, set, lane);
+	}
+
+	Waiter waiter;
+	waiter.deadline = deadline;
+	waiter.sequence = nextSequence_++;
+	waiter.set = nullptr;
+	waiters.push_back(&waiter);
+	std::push_heap(waiters.begin(), waiters.end(), Later);
+	waiter.granted.wait(lock, [&waiter] { return waiter.set != nullptr; });
+	return Lease(this, waiter.set, lane);
+}
+
+void EstimatorPool::release(EstimatorSet* set, Lane lane) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	lanes_->finished(lane);
+	free_.push_back(set);
+	// Sets are handed over directly, so a newcomer cannot take one first. A
+	// finished bulk call may also unblock bulk waiters held back by the
+	// reservation while sets were already free.
+	Lane next;
+	while (!free_.empty() && lanes_->pick(!waiters_[static_cast<int>(Lane::Interactive)].empty(),
+		!waiters_[static_cast<int>(Lane::Bulk)].empty(), &next)) {
+		std::vector<Waiter*>& waiters = waiters_[static_cast<int>(next)];
+		std::pop_heap(waiters.begin(), waiters.end(), Later);
+		Waiter* waiter = waiters.back();
+		waiters.pop_back();
+		waiter->set = free_.back();
+		free_.pop_back();
+		// Notified under the lock: the waiter lives on its thread's stack.
+		waiter->granted.notify_one();
+	}
+}
@@ -0,0 +1,143 @@
+#ifndef LUNAAPI_ESTIMATOR_POOL_H
+#define LUNAAPI_ESTIMATOR_POOL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fsdk/FaceEngine.h>
+
+#include "face_pool.h"
+#include "priority_lanes.h"
+#include "warp_dumper.h"
+
+// Server-wide limits of the processing pipeline, the same in every set.
+struct PipelineSettings {
+	// Larger JPEGs are decoded at a reduced DCT scale down to this longer
+	// side; 0 decodes at full size.
+	int jpegTargetSide = 0;
+
+	// Images with a longer side above this are detected on a reduced
+	// pyramid level; 0 detects at full size.
+	int detectMaxSide = 0;
+
+	// Faces returned when a request leaves MaxFaces unset.
+	int defaultMaxFaces = 10;
+	// Upper bound of ProcessingOptions.MaxFaces; sizes the detection
+	// buffers of every set.
+	int maxFacesLimit = 100;
+
+	// Smallest face, in pixels, the detector configuration searches for.
+	// Requests with a larger MinFaceSize detect on a reduced image so the
+	// finest pyramid levels are skipped; 0 disables this.
+	int detectorMinFace = 0;
+};
+
+// SDK objects needed to process one image. Estimators are not thread safe,
+// so a set is used by a single request at a time.
+struct EstimatorSet : FaceEstimators {
+	fsdk::IDetectorPtr faceDetector;
+
+	// Shared per-face stage. When set, the faces of an image are estimated
+	// in parallel on it, with the set's own estimators helping.
+	FacePool* facePool = nullptr;
+
+	// Debug capture of warps; null unless enabled at startup.
+	WarpDumper* warpDumper = nullptr;
+
+	PipelineSettings settings;
+
+	// Detector output of the request holding the set, sized to
+	// settings.maxFacesLimit up front so requests do not allocate.
+	std::vector<fsdk::Detection> detections;
+	std::vector<fsdk::Landmarks5> landmarks5;
+	std::vector<fsdk::Landmarks68> landmarks68;
+};
+
+// Owns the process-wide FaceEngine and a fixed number of estimator sets
+// created at startup. Requests check a set out for their lifetime and
+// block while all sets are in use. A returned set goes to the lane picked
+// by the LaneScheduler, and within it to the waiter with the earliest
+// deadline.
+class EstimatorPool {
+ public:
+	// Returns a set to the pool on destruction.
+	class Lease {
+	 public:
+		Lease(Lease&& other);
+		~Lease();
+
+		EstimatorSet* operator->() const { return set_; }
+		EstimatorSet& operator*() const { return *set_; }
+
+	 private:
+		friend class EstimatorPool;
+		Lease(EstimatorPool* pool, EstimatorSet* set, Lane lane) : pool_(pool), set_(set), lane_(lane) {}
+		Lease(const Lease&) = delete;
+		Lease& operator=(const Lease&) = delete;
+
+		EstimatorPool* pool_;
+		EstimatorSet* set_;
+		Lane lane_;
+	};
+
+	// Creates the engine and poolSize estimator sets. Prints the reason and
+	// returns false if any of the SDK objects could not be created.
+	bool init(const std::string& dataPath, const std::string& configPath, int poolSize);
+
+	// Spreads the per-face stages of all sets over threads threads, each
+	// with its own estimators.
+	bool enableFaceParallelism(int threads);
+
+	// Hands warps of all sets to dumper, which must stay alive while
+	// requests are served.
+	void setWarpDumper(WarpDumper* dumper);
+
+	// Applies settings to all sets and sizes their detection buffers.
+	void setPipelineSettings(const PipelineSettings& settings);
+
+	// Keeps reserved sets for interactive calls and gives bulk calls one
+	// set after every weight interactive ones while both wait. Call before
+	// serving; by default the lanes share all sets equally.
+	void setLanes(int reserved, int weight);
+
+	// Waits for a free set. Without a deadline the caller queues behind
+	// every waiter of its lane that has one. The no-argument form is an
+	// interactive call without a deadline.
+	Lease acquire();
+	Lease acquire(std::chrono::steady_clock::time_point deadline, Lane lane);
+
+	int size() const { return static_cast<int>(sets_.size()); }
+	const fsdk::IFaceEnginePtr& faceEngine() const { return faceEngine_; }
+
+ private:
+	// A blocked acquire() call.
+	struct Waiter {
+		std::chrono::steady_clock::time_point deadline;
+		uint64_t sequence;
+		EstimatorSet* set;
+		std::condition_variable granted;
+	};
+
+	// Orders the heap so the earliest deadline, then oldest waiter, is on top.
+	static bool Later(const Waiter* a, const Waiter* b);
+
+	bool createSet(EstimatorSet* set);
+	void release(EstimatorSet* set, Lane lane);
+
+	fsdk::IFaceEnginePtr faceEngine_;
+	std::vector<std::unique_ptr<EstimatorSet>> sets_;
+	std::unique_ptr<FacePool> facePool_;
+
+	std::mutex mutex_;
+	std::vector<EstimatorSet*> free_;
+	std::vector<Waiter*> waiters_[static_cast<int>(Lane::Count)];
+	std::unique_ptr<LaneScheduler> lanes_;
+	uint64_t nextSequence_ = 0;
+};
+
+#endif  // LUNAAPI_ESTIMATOR_POOL_H
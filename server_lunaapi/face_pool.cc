@@ -0,0 +1,155 @@
+#include "face_pool.h"
+
+#include "logger.h"
+
+bool CreateFaceEstimators(const fsdk::IFaceEnginePtr& faceEngine, FaceEstimators* estimators) {
+	// Create warper.
+	estimators->warper = fsdk::acquire(faceEngine->createWarper());
+	if (!estimators->warper) {
+		LUNA_LOG(Error) << "Failed to create face warper instance.";
+		return false;
+	}
+
+	// Create attribute estimator.
+	estimators->attributeEstimator = fsdk::acquire(faceEngine->createAttributeEstimator());
+	if (!estimators->attributeEstimator) {
+		LUNA_LOG(Error) << "Failed to create attribute estimator instance.";
+		return false;
+	}
+
+	// Create quality estimator.
+	estimators->qualityEstimator = fsdk::acquire(faceEngine->createQualityEstimator());
+	if (!estimators->qualityEstimator) {
+		LUNA_LOG(Error) << "Failed to create quality estimator instance.";
+		return false;
+	}
+
+	// Create head pose estimator.
+	estimators->headPoseEstimator = fsdk::acquire(faceEngine->createHeadPoseEstimator());
+	if (!estimators->headPoseEstimator) {
+		LUNA_LOG(Error) << "Failed to create head pose estimator instance.";
+		return false;
+	}
+
+	// Create overlap estimator.
+	estimators->overlapEstimator = fsdk::acquire(faceEngine->createOverlapEstimator());
+	if (!estimators->overlapEstimator) {
+		LUNA_LOG(Error) << "Failed to create overlap estimator instance.";
+		return false;
+	}
+	return true;
+}
+
+FacePool::~FacePool() {
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+		stopping_ = true;
+	}
+	queued_.notify_all();
+	for (const auto& worker : workers_) {
+		if (worker->thread.joinable())
+			worker->thread.join();
+	}
+}
+
+bool FacePool::start(const fsdk::IFaceEnginePtr& faceEngine, int threads) {
+	// Thieves walk workers_ without a lock, so it is complete before any
+	// thread starts.
+	for (int i = 0; i < threads; ++i) {
+		std::unique_ptr<Worker> worker(new Worker());
+		if (!CreateFaceEstimators(faceEngine, &worker->estimators))
+			return false;
+		workers_.push_back(std::move(worker));
+	}
+	for (size_t i = 0; i < workers_.size(); ++i)
+		workers_[i]->thread = std::thread(&FacePool::loop, this, i);
+	return true;
+}
+
+void FacePool::run(int count, FaceEstimators& callerEstimators, const Task& task) {
+	// Nothing to spread.
+	if (workers_.empty() || count <= 1) {
+		for (int i = 0; i < count; ++i)
+			task(callerEstimators, i);
+		return;
+	}
+
+	Job job;
+	job.task = &task;
+	job.remaining = count;
+	const size_t first = nextWorker_.fetch_add(1, std::memory_order_relaxed);
+	for (int i = 0; i < count; ++i) {
+		Worker& worker = *workers_[(first + i) % workers_.size()];
+		std::lock_guard<std::mutex> lock(worker.mutex);
+		worker.items.push_back(Item{&job, i});
+	}
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+		pending_ += count;
+	}
+	queued_.notify_all();
+
+	// Help instead of blocking; whatever is taken is run with the caller's
+	// own estimators.
+	Item item;
+	while (job.remaining.load() > 0 && take(workers_.size(), &item))
+		execute(item, callerEstimators);
+
+	std::unique_lock<std::mutex> lock(job.mutex);
+	job.finished.wait(lock, [&job] { return job.done; });
+}
+
+bool FacePool::take(size_t self, Item* item) {
+	const size_t count = workers_.size();
+	if (self < count) {
+		Worker& own = *workers_[self];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (!own.items.empty()) {
+			*item = own.items.back();
+			own.items.pop_back();
+			--pending_;
+			return true;
+		}
+	}
+	for (size_t k = 1; k <= count; ++k) {
+		const size_t victim = (self + k) % count;
+		if (victim == self)
+			continue;
+		Worker& other = *workers_[victim];
+		std::lock_guard<std::mutex> lock(other.mutex);
+		if (!other.items.empty()) {
+			*item = other.items.front();
+			other.items.pop_front();
+			--pending_;
+			return true;
+		}
+	}
+	return false;
+}
+
+void FacePool::execute(const Item& item, FaceEstimators& estimators) {
+	Job& job = *item.job;
+	(*job.task)(estimators, item.index);
+	if (job.remaining.fetch_sub(1) == 1) {
+		// Notified under the lock: the job lives on the caller's stack and
+		// is gone as soon as the caller sees done.
+		std::lock_guard<std::mutex> lock(job.mutex);
+		job.done = true;
+		job.finished.notify_all();
+	}
+}
+
+void FacePool::loop(size_t self) {
+	Worker& worker = *workers_[self];
+	for (;;) {
+		Item item;
+		if (take(self, &item)) {
+			execute(item, worker.estimators);
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(sleepMutex_);
+		queued_.wait(lock, [this] { return stopping_ || pending_.load() > 0; });
+		if (stopping_ && pending_.load() <= 0)
+			return;
+	}
+}
@@ -0,0 +1,93 @@
+#ifndef LUNAAPI_FACE_POOL_H
+#define LUNAAPI_FACE_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fsdk/FaceEngine.h>
+
+// Estimators run once per detected face. They are not thread safe, so
+// every thread using them has its own.
+struct FaceEstimators {
+	fsdk::IWarperPtr warper;
+	fsdk::IAttributeEstimatorPtr attributeEstimator;
+	fsdk::IQualityEstimatorPtr qualityEstimator;
+	fsdk::IHeadPoseEstimatorPtr headPoseEstimator;
+	fsdk::IOverlapEstimatorPtr overlapEstimator;
+};
+
+// Creates all estimators of a set. Prints the reason and returns false if
+// any of them could not be created.
+bool CreateFaceEstimators(const fsdk::IFaceEnginePtr& faceEngine, FaceEstimators* estimators);
+
+// Threads running the per-face stages of all requests. Each thread owns a
+// FaceEstimators set. The faces of a request are dealt round robin onto the
+// threads' deques; a thread takes from the back of its own deque and steals
+// from the front of the others once it runs dry, so a crowd image spreads
+// over every idle core.
+class FacePool {
+ public:
+	typedef std::function<void(FaceEstimators& estimators, int index)> Task;
+
+	FacePool() = default;
+	~FacePool();
+
+	// Creates the estimators of threads threads and starts them. Returns
+	// false if any estimator could not be created.
+	bool start(const fsdk::IFaceEnginePtr& faceEngine, int threads);
+
+	// Runs task for every index below count and returns once all have
+	// finished. The calling thread works through queued faces as well,
+	// using callerEstimators.
+	void run(int count, FaceEstimators& callerEstimators, const Task& task);
+
+	int threads() const { return static_cast<int>(workers_.size()); }
+
+ private:
+	// Faces of one run() call.
+	struct Job {
+		const Task* task;
+		std::atomic<int> remaining;
+		std::mutex mutex;
+		std::condition_variable finished;
+		bool done = false;
+	};
+
+	struct Item {
+		Job* job;
+		int index;
+	};
+
+	struct Worker {
+		FaceEstimators estimators;
+		std::mutex mutex;
+		std::deque<Item> items;
+		std::thread thread;
+	};
+
+	FacePool(const FacePool&) = delete;
+	FacePool& operator=(const FacePool&) = delete;
+
+	// Pops from the back of worker self, or steals from the front of the
+	// others; self may be out of range for a caller without a deque.
+	bool take(size_t self, Item* item);
+	void execute(const Item& item, FaceEstimators& estimators);
+	void loop(size_t self);
+
+	std::vector<std::unique_ptr<Worker>> workers_;
+	std::atomic<size_t> nextWorker_{0};
+
+	// Idle threads sleep here until faces are queued.
+	std::mutex sleepMutex_;
+	std::condition_variable queued_;
+	std::atomic<int> pending_{0};
+	bool stopping_ = false;
+};
+
+#endif  // LUNAAPI_FACE_POOL_H
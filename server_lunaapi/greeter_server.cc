@@ -1,307 +1,207 @@
-/*
- *
- * Copyright 2015 gRPC authors.
- *
- * Licensed under the Apache License, Version 2.0 (the "License");
- * you may not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- *     http://www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an "AS IS" BASIS,
- * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- *
- */
-
-#include <iostream>
-#include <memory>
-#include <string>
-
-#include <grpcpp/grpcpp.h>
-#include "test_api.grpc.pb.h"
+/*
+ *
+ * Copyright 2015 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include <grpcpp/grpcpp.h>
+#include "test_api.grpc.pb.h"
 #include <fsdk/FaceEngine.h>
 
-
-using grpc::Server;
-using grpc::ServerBuilder;
-using grpc::ServerContext;
-using grpc::Status;
-//using LunaSDK::Image;
-using LunaSDK::ImageProccessingResult;
-using LunaSDK::LunaSDKServer;
-
-// Logic and data behind the server's behavior.
-class GreeterServiceImpl final : public LunaSDKServer::Service {
-  Status Proccesing(ServerContext* context, const LunaSDK::Image* request, ImageProccessingResult* reply) override
-  {
-  /**/
-    //std::string prefix("Hello ");
-    if(request->image_data().size() == 0)
-		return Status(grpc::INVALID_ARGUMENT, "iamage_dat = 0");
-
-	//reply->set_message(prefix + request->name());
-	std::cout<< "Proccesing : Image len = "<<request->image_data_size()<< " size = { H"<< request->height()<<" : W"<<request->width() <<"}" <<std::endl;
+#include "admission_queue.h"
+#include "async_server.h"
+#include "color_convert.h"
+#include "estimator_pool.h"
+#include "image_processor.h"
+#include "logger.h"
+#include "metrics_server.h"
+#include "result_cache.h"
+#include "server_options.h"
+
 
-	// Facial feature detection confidence threshold.
-	//const float confidenceThreshold = 0.25f;
-
-	// Create FaceEngine root SDK object.
-	fsdk::IFaceEnginePtr faceEngine = fsdk::acquire(fsdk::createFaceEngine("./data", "./data/faceengine.conf"));
-	if (!faceEngine) {
-		std::cerr << "Failed to create face engine instance." << std::endl;
-		return Status(grpc::INTERNAL, "Failed to create face engine instance.");
-	}
-
-	// Create MTCNN detector.
-	fsdk::IDetectorPtr faceDetector = fsdk::acquire(faceEngine->createDetector(fsdk::ODT_MTCNN));
-	if (!faceDetector) {
-		std::cerr << "Failed to create face detector instance." << std::endl;
-		return  Status(grpc::INTERNAL,"Failed to create face detector instance.");
-	}
-
-	// Create warper.
-	fsdk::IWarperPtr warper = fsdk::acquire(faceEngine->createWarper());
-	if (!warper) {
-		std::cerr << "Failed to create face warper instance." << std::endl;
-		return  Status(grpc::INTERNAL,"Failed to create face warper instance.");
-	}
-
-	// Create attribute estimator.
-	fsdk::IAttributeEstimatorPtr attributeEstimator = fsdk::acquire(faceEngine->createAttributeEstimator());
-	if (!attributeEstimator) {
-		std::cerr << "Failed to create attribute estimator instance." << std::endl;
-		return  Status(grpc::INTERNAL,"Failed to create attribute estimator instance.");
-	}
-
-	// Create quality estimator.
-	fsdk::IQualityEstimatorPtr qualityEstimator = fsdk::acquire(faceEngine->createQualityEstimator());
-	if (!qualityEstimator) {
-		std::cerr << "Failed to create quality estimator instance." << std::endl;
-		return  Status(grpc::INTERNAL,"Failed to create quality estimator instance.");
-	}
-
-	// Create head pose estimator.
-	fsdk::IHeadPoseEstimatorPtr headPoseEstimator = fsdk::acquire(faceEngine->createHeadPoseEstimator());
-	if (!headPoseEstimator) {
-		std::cerr << "Failed to create head pose estimator instance." << std::endl;
-		return  Status(grpc::INTERNAL, "Failed to create head pose estimator instance.");
-	}
-
-	// Create overlap estimator.
-	fsdk::IOverlapEstimatorPtr overlapEstimator = fsdk::acquire(faceEngine->createOverlapEstimator());
-	if (!overlapEstimator) {
-		std::cerr << "Failed to create overlap estimator instance." << std::endl;
-		return  Status(grpc::INTERNAL, "Failed to create overlap estimator instance.");
-	}
-
-	// Load image
-	fsdk::Image image;
-	if (!image.loadFromMemory((void *)request->image_data().c_str(), request->image_data().size() , fsdk::Format::R8G8B8)) {
-		std::cerr << "Failed to load image" << std::endl;
-		return  Status(grpc::INTERNAL, "Failed to load image ");
-	}
-
-	std::clog << "Detecting faces." << std::endl;
-
-	// Detect no more than 10 faces in the image.
-	enum { MaxDetections = 10 };
+using grpc::Server;
+using grpc::ServerBuilder;
+using grpc::ServerContext;
+using grpc::Status;
+//using LunaSDK::Image;
+using LunaSDK::ImageProccessingResult;
+using LunaSDK::LunaSDKServer;
 
-	// Data used for detection.
-	fsdk::Detection detections[MaxDetections];
-	int detectionsCount(MaxDetections);
-	fsdk::Landmarks5 landmarks5[MaxDetections];
-	fsdk::Landmarks68 landmarks68[MaxDetections];
-
-	// Detect faces in the image.
-	fsdk::ResultValue<fsdk::FSDKError, int> detectorResult = faceDetector->detect(
-		image,
-		image.getRect(),
-		&detections[0],
-		&landmarks5[0],
-		&landmarks68[0],
-		detectionsCount
-	);
-
-	if (detectorResult.isError()) {
-		std::cerr << "Failed to detect face detection. Reason: " << detectorResult.what() << std::endl;
-		return Status(grpc::INTERNAL, "Failed to detect face detection.");
-	}
-
-	detectionsCount = detectorResult.getValue();
-	if (detectionsCount == 0) {
-		std::clog << "Faces is not found." << std::endl;
-		return Status::OK;
-	}
-	std::clog << "Found " << detectionsCount << " face(s)." << std::endl;
-
-	// Loop through all the faces.
-	for (int detectionIndex = 0; detectionIndex < detectionsCount; ++detectionIndex) 
+// Logic and data behind the server's behavior.
+class GreeterServiceImpl final : public LunaSDKServer::Service {
+ public:
+  GreeterServiceImpl(EstimatorPool& pool, WorkerPool& workers, AdmissionQueue& admission, ResultCache* cache)
+    : pool_(pool), workers_(workers), admission_(admission), cache_(cache) {}
+
+ private:
+  Status Proccesing(ServerContext* context, const LunaSDK::Image* request, ImageProccessingResult* reply) override
+  {
+	// Repeated images are answered before admission, without an estimator set.
+	const ImageRequestView view = ViewOf(*request);
+	ResultKey cacheKey;
+	const bool cacheable = cache_ != nullptr && cache_->mayHold(view.size);
+	if (cacheable) {
+		cacheKey = ResultCacheKey(view);
+		const ResultCache::Value cached = cache_->find(cacheKey);
+		if (cached && reply->ParseFromString(*cached))
+			return Status::OK;
+	}
+
+	const CallControl control(context, true);
+	AdmissionQueue::Ticket ticket = admission_.tryEnter(control.lane());
+	if (!ticket)
+		return OverloadedStatus();
+	Status status;
 	{
-		::LunaSDK::FaceFountAttribute* face_ = reply->add_facefounts();
-		::LunaSDK::Rectangle* rect = new ::LunaSDK::Rectangle();
-		rect->set_height(detections[detectionIndex].rect.height);
-		rect->set_width(detections[detectionIndex].rect.width);
-		rect->set_x(detections[detectionIndex].rect.x);
-		rect->set_y(detections[detectionIndex].rect.y);
-		face_->set_allocated_rect(rect);
-
-		std::cout << "Detection " << detectionIndex + 1 <<
-			"\nRect: x=" << detections[detectionIndex].rect.x <<
-			" y=" << detections[detectionIndex].rect.y <<
-			" w=" << detections[detectionIndex].rect.width <<
-			" h=" << detections[detectionIndex].rect.height << std::endl;
-
-		face_->set_score(detections[detectionIndex].score);
-
-		//// Estimate confidence score of face detection.
-		//if (detections[detectionIndex].score < confidenceThreshold) {
-		//	std::clog << "Face detection succeeded, but confidence score of detection is small." << std::endl;
-		//	continue;
-		//}
-
-		// Get warped face from detection.
-		fsdk::Transformation transformation;
-		fsdk::Landmarks5 transformedLandmarks5;
-		fsdk::Landmarks68 transformedLandmarks68;
-		fsdk::Image warp;
-		transformation = warper->createTransformation(detections[detectionIndex], landmarks5[detectionIndex]);
-		fsdk::Result<fsdk::FSDKError> transformedLandmarks5Result = warper->warp(
-			landmarks5[detectionIndex],
-			transformation,
-			transformedLandmarks5
-		);
-		
-		if (transformedLandmarks5Result.isError()) {
-			std::cerr << "Failed to create transformed landmarks5. Reason: " <<
-				transformedLandmarks5Result.what() << std::endl;
-			return Status(grpc::INTERNAL, "Failed to create transformed landmarks5. Reason: ");
-		}
-		fsdk::Result<fsdk::FSDKError> transformedLandmarks68Result = warper->warp(
-			landmarks68[detectionIndex],
-			transformation,
-			transformedLandmarks68
-		);
-		if (transformedLandmarks68Result.isError()) {
-			std::cerr << "Failed to create transformed landmarks68. Reason: " <<
-				transformedLandmarks68Result.what() << std::endl;
-			return Status(grpc::INTERNAL, "Failed to create transformed landmarks68. Reason: ");
-		}
-		fsdk::Result<fsdk::FSDKError> warperResult = warper->warp(image, transformation, warp);
-		if (warperResult.isError()) {
-			std::cerr << "Failed to create warped face. Reason: " << warperResult.what() << std::endl;
-			return Status(grpc::INTERNAL, "Failed to create warped face. Reason: ");
-		}
-
-		// Save warped face.
-		warp.save(("warp_" + std::to_string(detectionIndex) + ".ppm").c_str());
-		LunaSDK::Image* warpImage = new LunaSDK::Image();
-
-		face_->set_allocated_warpiamge(warpImage);
-
-		// Get attribute estimate.
-		fsdk::AttributeEstimation attributeEstimation;
-		fsdk::Result<fsdk::FSDKError> attributeEstimatorResult = attributeEstimator->estimate(warp, attributeEstimation);
-		if (attributeEstimatorResult.isError()) {
-			std::cerr << "Failed to create attribute estimation. Reason: " << attributeEstimatorResult.what() << std::endl;
-			return Status(grpc::INTERNAL, "Failed to create attribute estimation. Reason: ");
-		}
-		std::cout << "\nAttribure estimate:" <<
-			"\ngender: " << attributeEstimation.gender << " (1 - man, 0 - woman)"
-			"\nglasses: " << attributeEstimation.glasses <<
-			" (1 - person wears glasses, 0 - person doesn't wear glasses)" <<
-			"\nage: " << attributeEstimation.age << " (in years)" << std::endl;
-
-		// Get quality estimate.
-		fsdk::Quality qualityEstimation;
-		fsdk::Result<fsdk::FSDKError> qualityEstimationResult = qualityEstimator->estimate(warp, qualityEstimation);
-		if (qualityEstimationResult.isError()) {
-			std::cerr << "Failed to create quality estimation. Reason: " << qualityEstimationResult.what() << std::endl;
-			return Status(grpc::INTERNAL, "Failed to create quality estimation. Reason: ");
-		}
-
-		LunaSDK::QualityFaceFountAttribute * Quality = new LunaSDK::QualityFaceFountAttribute();
-		Quality->set_ligth(qualityEstimation.light);
-		Quality->set_dark(qualityEstimation.dark);
-		Quality->set_gray(qualityEstimation.gray);
-		Quality->set_blur(qualityEstimation.blur);
-		Quality->set_quality(qualityEstimation.getQuality());
-		face_->set_allocated_quality(Quality);
-
-		std::cout << "Quality estimate:" <<
-			"\nlight: " << qualityEstimation.light <<
-			"\ndark: " << qualityEstimation.dark <<
-			"\ngray: " << qualityEstimation.gray <<
-			"\nblur: " << qualityEstimation.blur <<
-			"\nquality: " << qualityEstimation.getQuality() << std::endl;
-
-		// Get head pose estimate.
-		fsdk::HeadPoseEstimation headPoseEstimation;
-		fsdk::Result<fsdk::FSDKError> headPoseEstimationResult = headPoseEstimator->estimate(
-			image,
-			detections[detectionIndex],
-			headPoseEstimation
-		);
-		if (headPoseEstimationResult.isError()) {
-			std::cerr << "Failed to create head pose estimation. Reason: " << headPoseEstimationResult.what() << std::endl;
-			return Status(grpc::INTERNAL, "Failed to create head pose estimation. Reason: ");
-		}
-		LunaSDK::HeadPoseFaceFountAttribute* HeadPose = new LunaSDK::HeadPoseFaceFountAttribute();
-		HeadPose->set_pitch(headPoseEstimation.pitch);
-		HeadPose->set_yaw(headPoseEstimation.yaw);
-		HeadPose->set_roll(headPoseEstimation.roll);
-		face_->set_allocated_headpos(HeadPose);
-
-		std::cout << "Head pose estimate:" <<
-			"\npitch angle estimation: " << headPoseEstimation.pitch <<
-			"\nyaw angle estimation: " << headPoseEstimation.yaw <<
-			"\nroll angle estimation: " << headPoseEstimation.roll <<
-			std::endl;
-		std::cout << std::endl;
-
-		// Get overlap estimation.
-		fsdk::OverlapEstimation overlapEstimation;
-		fsdk::Result<fsdk::FSDKError> overlapEstimationResult = overlapEstimator->estimate(
-			image, detections[0], overlapEstimation);
-
-		if (overlapEstimationResult.isError()) {
-			std::cerr << "Failed overlap estimation. Reason: " << overlapEstimationResult.what() << std::endl;
-			return Status(grpc::INTERNAL, "Failed overlap estimation. Reason: ");
-		}
-
-		std::cout << "Face overlap estimate:"
-			<< "\noverlapValue: " << overlapEstimation.overlapValue << " (range [0, 1])"
-			<< "\noverlapped: " << overlapEstimation.overlapped << " (0 - not overlapped, 1 - overlapped)"
-			<< std::endl;
-	}
-/**/
-	return Status::OK;   
-  }
-};
-
-void RunServer() {
-  std::string server_address("0.0.0.0:50051");
-  GreeterServiceImpl service;
-
-  ServerBuilder builder;
-  // Listen on the given address without any authentication mechanism.
-  builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-  // Register "service" as the instance through which we'll communicate with
-  // clients. In this case it corresponds to an *synchronous* service.
-  builder.RegisterService(&service);
-  // Finally assemble the server.
-  std::unique_ptr<Server> server(builder.BuildAndStart());
-  std::cout << "Server listening on " << server_address << std::endl;
-
-  // Wait for the server to shutdown. Note that some other thread must be
-  // responsible for shutting down the server for this call to ever return.
-  server->Wait();
-}
-
-int main(int argc, char** argv) {
-  RunServer();
-
-  return 0;
-}
+		// Check out a preloaded estimator set for the lifetime of the request.
+		EstimatorPool::Lease estimators = pool_.acquire(control.deadline(), control.lane());
+		ticket.started();
+		status = ProcessImage(*estimators, view, control, reply);
+	}
+	if (cacheable && status.ok())
+		cache_->insert(cacheKey, reply->SerializeAsString());
+	return status;
+  }
+
+  Status ProcessStream(ServerContext* context,
+                       grpc::ServerReaderWriter<ImageProccessingResult, LunaSDK::Image>* stream) override
+  {
+	const Lane lane = LaneOf(context);
+	AdmissionQueue::Ticket ticket = admission_.tryEnter(lane);
+	if (!ticket)
+		return OverloadedStatus();
+	// One estimator set serves the whole stream.
+	EstimatorPool::Lease estimators = pool_.acquire(std::chrono::steady_clock::time_point::max(), lane);
+	ticket.started();
+	return ProcessImageStream(*estimators, context, stream);
+  }
+
+  Status ProcessBatch(ServerContext* context, const LunaSDK::ImageBatch* request,
+                      LunaSDK::ImageBatchResult* reply) override
+  {
+	const CallControl control(context, true);
+	// Every image takes a place in the admission queue.
+	AdmissionQueue::Ticket ticket = admission_.tryEnter(control.lane(), std::max(1, request->images_size()));
+	if (!ticket)
+		return OverloadedStatus();
+	return ProcessImageBatch(pool_, workers_, *request, control, ticket.admitted(), reply);
+  }
+
+  EstimatorPool& pool_;
+  WorkerPool& workers_;
+  AdmissionQueue& admission_;
+  ResultCache* cache_;
+};
+
+void RunServer(const ServerOptions& options, EstimatorPool& pool, WorkerPool& workers,
+  AdmissionQueue& admission, ResultCache* cache) {
+  const std::string& server_address = options.address;
+  GreeterServiceImpl service(pool, workers, admission, cache);
+
+  ServerBuilder builder;
+  // Listen on the given address without any authentication mechanism.
+  builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+  // Register "service" as the instance through which we'll communicate with
+  // clients. In this case it corresponds to an *synchronous* service.
+  builder.RegisterService(&service);
+  // Finally assemble the server.
+  std::unique_ptr<Server> server(builder.BuildAndStart());
+  LUNA_LOG(Info) << "Server listening on " << server_address;
+
+  // Wait for the server to shutdown. Note that some other thread must be
+  // responsible for shutting down the server for this call to ever return.
+  server->Wait();
+}
+
+int main(int argc, char** argv) {
+  ServerOptions options;
+  if (!ParseServerOptions(argc, argv, &options))
+    return 1;
+
+  // The dump signal has to be blocked before any thread exists so that
+  // only the dumper thread receives it.
+  if (options.metricsDumpSignal != 0)
+    metrics::BlockDumpSignal(options.metricsDumpSignal);
+
+  logging::Session logSession(options.logLevel, options.logSampleEvery);
+
+  if (options.metricsDumpSignal != 0)
+    metrics::StartSignalDumper(options.metricsDumpSignal);
+  MetricsServer metricsServer;
+  if (options.metricsPort != 0 && !metricsServer.start(options.metricsPort))
+    return 1;
+
+  // Load the models once; requests only check estimator sets out of the pool.
+  EstimatorPool pool;
+  if (!pool.init(options.dataPath, options.configPath, options.poolSize))
+    return 1;
+  LUNA_LOG(Info) << "Estimator pool ready: " << pool.size() << " set(s)";
+  LUNA_LOG(Info) << "Raw frame conversion uses " << SimdLevelName(DetectSimdLevel()) << " kernels";
+  PipelineSettings settings;
+  settings.jpegTargetSide = options.jpegTargetSide;
+  settings.detectMaxSide = options.detectMaxSide;
+  settings.defaultMaxFaces = options.maxFaces;
+  settings.maxFacesLimit = options.maxFacesLimit;
+  settings.detectorMinFace = options.detectorMinFace;
+  pool.setPipelineSettings(settings);
+
+  if (options.faceThreads > 0) {
+    if (!pool.enableFaceParallelism(options.faceThreads))
+      return 1;
+    LUNA_LOG(Info) << "Per-face estimation spread over " << options.faceThreads << " extra thread(s)";
+  }
+
+  std::unique_ptr<WarpDumper> warpDumper;
+  if (!options.dumpWarpsDir.empty()) {
+    warpDumper.reset(new WarpDumper(options.dumpWarpsDir, options.dumpWarpsQueue));
+    pool.setWarpDumper(warpDumper.get());
+  }
+
+  // Interactive calls keep interactiveReserved sets and workers to
+  // themselves; bulk calls get the rest.
+  pool.setLanes(options.interactiveReserved, options.interactiveWeight);
+  LUNA_LOG(Info) << "Priority lanes: " << options.interactiveReserved << " set(s) reserved for interactive calls, "
+    << "interactive weight " << options.interactiveWeight;
+
+  // Inference threads for work that is not run on the calling thread.
+  WorkerPool workers(pool.size(), options.interactiveReserved, options.interactiveWeight);
+
+  // Calls of a lane beyond the ones it may process and queueDepth waiting
+  // are shed.
+  const int bulkSlots = std::max(1, pool.size() - options.interactiveReserved);
+  AdmissionQueue admission(options.queueDepth > 0 ? pool.size() + options.queueDepth : 0,
+    options.queueDepth > 0 ? bulkSlots + options.queueDepth : 0);
+
+  std::unique_ptr<ResultCache> resultCache;
+  if (options.resultCacheMb > 0) {
+    resultCache.reset(new ResultCache(static_cast<size_t>(options.resultCacheMb) * 1024 * 1024,
+      options.resultCacheShards));
+    LUNA_LOG(Info) << "Result cache: " << options.resultCacheMb << " MB in " << options.resultCacheShards
+      << " shard(s)";
+  }
+
+  if (options.mode != ServerMode::Sync) {
+    AsyncServer server(options, pool, workers, admission, resultCache.get());
+    server.Run();
+  } else {
+    RunServer(options, pool, workers, admission, resultCache.get());
+  }
+
+  return 0;
+}
@@ -0,0 +1,883 @@
+#include "image_processor.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "batch_estimators.h"
+#include "bounded_queue.h"
+#include "color_convert.h"
+#include "image_pyramid.h"
+#include "jpeg_codec.h"
+#include "logger.h"
+#include "metrics.h"
+
+unsigned RequestedStages(const LunaSDK::ProcessingOptions& options)
+{
+	if (options.stages_size() == 0)
+		return StageAll;
+
+	unsigned stages = 0;
+	for (int stage : options.stages()) {
+		switch (stage) {
+		case LunaSDK::STAGE_WARP: stages |= StageWarp; break;
+		case LunaSDK::STAGE_ATTRIBUTES: stages |= StageAttributes; break;
+		case LunaSDK::STAGE_QUALITY: stages |= StageQuality; break;
+		case LunaSDK::STAGE_HEAD_POSE: stages |= StageHeadPose; break;
+		case LunaSDK::STAGE_OVERLAP: stages |= StageOverlap; break;
+		case LunaSDK::STAGE_LANDMARKS5: stages |= StageLandmarks5; break;
+		case LunaSDK::STAGE_LANDMARKS68: stages |= StageLandmarks68; break;
+		default: break;
+		}
+	}
+	return stages;
+}
+
+namespace {
+
+enum { DefaultWarpJpegQuality = 90 };
+
+// Metrics stages run for the requested stages, as StageBit()s, so
+// deadline checks can count everything still ahead of a call.
+unsigned PipelineOf(unsigned stages)
+{
+	unsigned pipeline = StageBit(metrics::Stage::ImageLoad) | StageBit(metrics::Stage::Detect);
+	// Attributes and quality are estimated on the warped face.
+	if (stages & (StageWarp | StageAttributes | StageQuality))
+		pipeline |= StageBit(metrics::Stage::Warp);
+	if (stages & StageAttributes)
+		pipeline |= StageBit(metrics::Stage::Attributes);
+	if (stages & StageQuality)
+		pipeline |= StageBit(metrics::Stage::Quality);
+	if (stages & StageHeadPose)
+		pipeline |= StageBit(metrics::Stage::HeadPose);
+	if (stages & StageOverlap)
+		pipeline |= StageBit(metrics::Stage::Overlap);
+	return pipeline;
+}
+
+// Copies or compresses the warp pixels straight into the reply message.
+bool FillWarpImage(const fsdk::Image& warp, const LunaSDK::ProcessingOptions& options,
+	LunaSDK::Image* warpImage)
+{
+	const int width = warp.getWidth();
+	const int height = warp.getHeight();
+	warpImage->set_width(width);
+	warpImage->set_height(height);
+	if (options.returnwarp() == LunaSDK::WARP_NONE)
+		return true;
+
+	if (warp.getFormat() != fsdk::Format::R8G8B8) {
+		LUNA_LOG(Error) << "Unexpected warp format " << static_cast<int>(warp.getFormat());
+		return false;
+	}
+	const uint8_t* pixels = static_cast<const uint8_t*>(warp.getData());
+	const int rowStride = warp.getRowSize();
+	const int rowBytes = width * 3;
+	std::string* data = warpImage->mutable_image_data();
+
+	warpImage->set_format(LunaSDK::PIXEL_RGB);
+	warpImage->set_encoding(options.returnwarp() == LunaSDK::WARP_JPEG ? LunaSDK::ENCODING_JPEG : LunaSDK::ENCODING_RAW);
+	if (options.returnwarp() == LunaSDK::WARP_JPEG) {
+		const int quality = options.warpjpegquality() > 0 ? options.warpjpegquality() : DefaultWarpJpegQuality;
+		if (!EncodeJpegRgb(pixels, width, height, rowStride, quality, data))
+			return false;
+	} else if (rowStride == rowBytes) {
+		data->assign(reinterpret_cast<const char*>(pixels), static_cast<size_t>(rowBytes) * height);
+	} else {
+		data->reserve(static_cast<size_t>(rowBytes) * height);
+		for (int y = 0; y < height; ++y)
+			data->append(reinterpret_cast<const char*>(pixels + static_cast<size_t>(y) * rowStride), rowBytes);
+	}
+	warpImage->set_image_data_size(static_cast<int>(data->size()));
+	return true;
+}
+
+bool ToPixelLayout(LunaSDK::PixelFormat format, PixelLayout* layout)
+{
+	switch (format) {
+	case LunaSDK::PIXEL_RGB: *layout = PixelLayout::Rgb; return true;
+	case LunaSDK::PIXEL_BGR: *layout = PixelLayout::Bgr; return true;
+	case LunaSDK::PIXEL_RGBA: *layout = PixelLayout::Rgba; return true;
+	case LunaSDK::PIXEL_GRAY: *layout = PixelLayout::Gray; return true;
+	case LunaSDK::PIXEL_NV12: *layout = PixelLayout::Nv12; return true;
+	case LunaSDK::PIXEL_YUV420: *layout = PixelLayout::Yuv420; return true;
+	default: return false;
+	}
+}
+
+// Uncompressed frames skip decoding. Packed RGB is what the estimators
+// take, so it is wrapped without a copy; everything else is converted
+// into a new R8G8B8 image.
+grpc::Status LoadRawPixels(const ImageRequestView& request, fsdk::Image* image)
+{
+	PixelLayout layout;
+	if (!ToPixelLayout(request.format, &layout))
+		return grpc::Status(grpc::INVALID_ARGUMENT, "Raw image needs a pixel format");
+	if (request.width <= 0 || request.height <= 0)
+		return grpc::Status(grpc::INVALID_ARGUMENT, "Raw image needs width and height");
+	// Caps the sizes below, which a forged width could otherwise wrap.
+	if (request.width > MaxFrameSide || request.height > MaxFrameSide)
+		return grpc::Status(grpc::INVALID_ARGUMENT, "Raw image is larger than the server accepts");
+
+	const int minStride = static_cast<int>(MinRowStride(layout, request.width));
+	const int stride = request.stride > 0 ? request.stride : minStride;
+	if (stride < minStride)
+		return grpc::Status(grpc::INVALID_ARGUMENT, "Stride is smaller than a row");
+	if (stride > MaxRowStride)
+		return grpc::Status(grpc::INVALID_ARGUMENT, "Stride is larger than the server accepts");
+	if (request.size < FrameBytes(layout, request.width, request.height, stride))
+		return grpc::Status(grpc::INVALID_ARGUMENT, "image_data is smaller than the frame");
+
+	const uint8_t* pixels = static_cast<const uint8_t*>(request.data);
+	if (layout == PixelLayout::Rgb && stride == minStride) {
+		if (image->set(request.width, request.height, fsdk::Format::R8G8B8, const_cast<uint8_t*>(pixels)))
+			return grpc::Status::OK;
+	} else if (image->create(request.width, request.height, fsdk::Format::R8G8B8)) {
+		ConvertToRgb(layout, pixels, request.width, request.height, stride,
+			static_cast<uint8_t*>(image->getData()), image->getRowSize());
+		return grpc::Status::OK;
+	}
+
+	metrics::CountError(metrics::Stage::ImageLoad);
+	LUNA_LOG(Error) << "Failed to create " << request.width << "x" << request.height << " image";
+	return grpc::Status(grpc::INTERNAL, "Failed to load image ");
+}
+
+// Detection on one area of the image. Returns the number of faces found,
+// or -1 with the SDK reason in error.
+int DetectArea(EstimatorSet& estimators, const fsdk::Image& image, const fsdk::Rect& area,
+	fsdk::Detection* detections, fsdk::Landmarks5* landmarks5, fsdk::Landmarks68* landmarks68,
+	int maxCount, std::string* error)
+{
+	fsdk::ResultValue<fsdk::FSDKError, int> detectorResult = estimators.faceDetector->detect(
+		image,
+		area,
+		detections,
+		landmarks5,
+		landmarks68,
+		maxCount
+	);
+	if (detectorResult.isError()) {
+		*error = detectorResult.what();
+		return -1;
+	}
+	return detectorResult.getValue();
+}
+
+fsdk::Rect Intersect(const fsdk::Rect& a, const fsdk::Rect& b)
+{
+	const int left = std::max(a.x, b.x);
+	const int top = std::max(a.y, b.y);
+	const int right = std::min(a.x + a.width, b.x + b.width);
+	const int bottom = std::min(a.y + a.height, b.y + b.height);
+	if (right <= left || bottom <= top)
+		return fsdk::Rect(0, 0, 0, 0);
+	return fsdk::Rect(left, top, right - left, bottom - top);
+}
+
+int Area(const fsdk::Rect& rect)
+{
+	return rect.width * rect.height;
+}
+
+// Two detections from different regions cover the same face when they
+// overlap by half (IoU), or when one is mostly inside the other, as with a
+// face cut by the border of one region and whole in another.
+bool SameFace(const fsdk::Rect& a, const fsdk::Rect& b)
+{
+	const int common = Area(Intersect(a, b));
+	if (common == 0)
+		return false;
+	const int smaller = std::min(Area(a), Area(b));
+	return 2 * common > Area(a) + Area(b) - common || 10 * common >= 7 * smaller;
+}
+
+// Detects faces in the requested regions of image, or in all of it when
+// there are none. Regions are given in request coordinates and mapped with
+// requestToImage. Results of later regions that repeat a face already found
+// replace it only when they score higher. landmarks68 may be null to skip
+// them. Returns the number of faces, or -1 with the reason in error.
+int DetectFaces(EstimatorSet& estimators, const fsdk::Image& image,
+	const google::protobuf::RepeatedPtrField<LunaSDK::Rectangle>& regions,
+	const CoordinateTransform& requestToImage, fsdk::Detection* detections,
+	fsdk::Landmarks5* landmarks5, fsdk::Landmarks68* landmarks68, int maxCount, std::string* error)
+{
+	if (regions.empty())
+		return DetectArea(estimators, image, image.getRect(), detections, landmarks5, landmarks68,
+			maxCount, error);
+
+	int count = 0;
+	for (const LunaSDK::Rectangle& region : regions) {
+		if (count == maxCount)
+			break;
+		const fsdk::Rect area = Intersect(image.getRect(), requestToImage.apply(
+			fsdk::Rect(region.x(), region.y(), region.width(), region.height())));
+		if (Area(area) == 0)
+			continue;
+
+		const int found = DetectArea(estimators, image, area, detections + count, landmarks5 + count,
+			landmarks68 ? landmarks68 + count : nullptr, maxCount - count, error);
+		if (found < 0)
+			return -1;
+
+		// New faces are appended at count; repeats are folded into the
+		// earlier entry and the last new face takes their slot.
+		const int previous = count;
+		int end = count + found;
+		for (int i = previous; i < end;) {
+			int repeat = -1;
+			for (int j = 0; j < previous && repeat < 0; ++j) {
+				if (SameFace(detections[i].rect, detections[j].rect))
+					repeat = j;
+			}
+			if (repeat < 0) {
+				++i;
+				continue;
+			}
+			if (detections[i].score > detections[repeat].score) {
+				detections[repeat] = detections[i];
+				landmarks5[repeat] = landmarks5[i];
+				if (landmarks68)
+					landmarks68[repeat] = landmarks68[i];
+			}
+			--end;
+			if (i != end) {
+				detections[i] = detections[end];
+				landmarks5[i] = landmarks5[end];
+				if (landmarks68)
+					landmarks68[i] = landmarks68[end];
+			}
+		}
+		count = end;
+	}
+	return count;
+}
+
+// Removes detections below scoreThreshold or narrower or lower than
+// minFaceSize, keeping the order of the rest. landmarks68 may be null.
+// Returns the new count; a negative count is an error and is passed
+// through.
+int DropFaces(float scoreThreshold, float minFaceSize, fsdk::Detection* detections,
+	fsdk::Landmarks5* landmarks5, fsdk::Landmarks68* landmarks68, int count) {
+	int kept = 0;
+	for (int i = 0; i < count; ++i) {
+		const fsdk::Detection& detection = detections[i];
+		if (detection.score < scoreThreshold || detection.rect.width < minFaceSize ||
+			detection.rect.height < minFaceSize)
+			continue;
+		if (kept != i) {
+			detections[kept] = detections[i];
+			landmarks5[kept] = landmarks5[i];
+			if (landmarks68)
+				landmarks68[kept] = landmarks68[i];
+		}
+		++kept;
+	}
+	return count < 0 ? count : kept;
+}
+
+// Appends landmarks to a reply field as x, y pairs.
+template <class Landmarks>
+void AppendLandmarks(const Landmarks& landmarks, google::protobuf::RepeatedField<float>* out)
+{
+	out->Reserve(out->size() + 2 * Landmarks::landmarkCount);
+	for (int i = 0; i < Landmarks::landmarkCount; ++i) {
+		out->AddAlreadyReserved(landmarks.landmarks[i].x);
+		out->AddAlreadyReserved(landmarks.landmarks[i].y);
+	}
+}
+
+// Everything the per-face stages read. Shared by the threads estimating
+// the faces of one image, none of which modifies it.
+struct FaceInputs {
+	const fsdk::Image* image;
+	const CoordinateTransform* toRequest;
+	const fsdk::Detection* detections;
+	const fsdk::Landmarks5* landmarks5;
+	const fsdk::Landmarks68* landmarks68;
+	const LunaSDK::ProcessingOptions* options;
+	unsigned stages;
+	bool needWarp;
+	// StageBit()s of the metrics stages the request runs.
+	unsigned pipeline;
+	WarpDumper* warpDumper;
+	uint64_t dumpRequestId;
+	const CallControl* control;
+};
+
+// Fills the detection and landmark fields of face_ and warps the face
+// into warp when a later stage needs it.
+grpc::Status WarpFace(FaceEstimators& estimators, const FaceInputs& inputs, int detectionIndex,
+	::LunaSDK::FaceFountAttribute* face_, fsdk::Image* warp)
+{
+	const fsdk::Image& image = *inputs.image;
+	const CoordinateTransform& toRequest = *inputs.toRequest;
+	const fsdk::Detection* detections = inputs.detections;
+	const fsdk::Landmarks5* landmarks5 = inputs.landmarks5;
+	const fsdk::Landmarks68* landmarks68 = inputs.landmarks68;
+	const LunaSDK::ProcessingOptions& options = *inputs.options;
+	const unsigned stages = inputs.stages;
+	WarpDumper* warpDumper = inputs.warpDumper;
+
+	// Calls without a warp have nothing left to run after detection.
+	if (inputs.needWarp && !inputs.control->canRun(metrics::Stage::Warp, inputs.pipeline))
+		return inputs.control->stopStatus();
+
+	// Sub-messages come from mutable_*() so they are allocated on the
+	// reply's arena when it has one.
+	::LunaSDK::Rectangle* rect = face_->mutable_rect();
+	const fsdk::Rect requestRect = toRequest.apply(detections[detectionIndex].rect);
+	rect->set_height(requestRect.height);
+	rect->set_width(requestRect.width);
+	rect->set_x(requestRect.x);
+	rect->set_y(requestRect.y);
+
+	LUNA_LOG_SAMPLED(Debug) << "Detection " << detectionIndex + 1 <<
+		" rect: x=" << detections[detectionIndex].rect.x <<
+		" y=" << detections[detectionIndex].rect.y <<
+		" w=" << detections[detectionIndex].rect.width <<
+		" h=" << detections[detectionIndex].rect.height;
+
+	face_->set_score(detections[detectionIndex].score);
+
+	if (stages & StageLandmarks5) {
+		fsdk::Landmarks5 requestLandmarks5 = landmarks5[detectionIndex];
+		toRequest.apply(&requestLandmarks5);
+		AppendLandmarks(requestLandmarks5, face_->mutable_landmarks5());
+	}
+	if (stages & StageLandmarks68) {
+		fsdk::Landmarks68 requestLandmarks68 = landmarks68[detectionIndex];
+		toRequest.apply(&requestLandmarks68);
+		AppendLandmarks(requestLandmarks68, face_->mutable_landmarks68());
+	}
+
+	//// Estimate confidence score of face detection.
+	//if (detections[detectionIndex].score < confidenceThreshold) {
+	//	LUNA_LOG(Debug) << "Face detection succeeded, but confidence score of detection is small.";
+	//	return grpc::Status::OK;
+	//}
+
+	if (inputs.needWarp) {
+		metrics::StageTimer timer(metrics::Stage::Warp);
+		// Get warped face from detection.
+		fsdk::Transformation transformation;
+		transformation = estimators.warper->createTransformation(detections[detectionIndex], landmarks5[detectionIndex]);
+		// Warped landmarks are only of use to the caller, so they are
+		// computed when returned with the warp.
+		if ((stages & StageWarp) && (stages & StageLandmarks5)) {
+			fsdk::Landmarks5 transformedLandmarks5;
+			fsdk::Result<fsdk::FSDKError> transformedLandmarks5Result = estimators.warper->warp(
+				landmarks5[detectionIndex],
+				transformation,
+				transformedLandmarks5
+			);
+			if (transformedLandmarks5Result.isError()) {
+				metrics::CountError(metrics::Stage::Warp);
+				LUNA_LOG(Error) << "Failed to create transformed landmarks5. Reason: " <<
+					transformedLandmarks5Result.what();
+				return grpc::Status(grpc::INTERNAL, "Failed to create transformed landmarks5. Reason: ");
+			}
+			AppendLandmarks(transformedLandmarks5, face_->mutable_warplandmarks5());
+		}
+		if ((stages & StageWarp) && (stages & StageLandmarks68)) {
+			fsdk::Landmarks68 transformedLandmarks68;
+			fsdk::Result<fsdk::FSDKError> transformedLandmarks68Result = estimators.warper->warp(
+				landmarks68[detectionIndex],
+				transformation,
+				transformedLandmarks68
+			);
+			if (transformedLandmarks68Result.isError()) {
+				metrics::CountError(metrics::Stage::Warp);
+				LUNA_LOG(Error) << "Failed to create transformed landmarks68. Reason: " <<
+					transformedLandmarks68Result.what();
+				return grpc::Status(grpc::INTERNAL, "Failed to create transformed landmarks68. Reason: ");
+			}
+			AppendLandmarks(transformedLandmarks68, face_->mutable_warplandmarks68());
+		}
+		fsdk::Result<fsdk::FSDKError> warperResult = estimators.warper->warp(image, transformation, *warp);
+		if (warperResult.isError()) {
+			metrics::CountError(metrics::Stage::Warp);
+			LUNA_LOG(Error) << "Failed to create warped face. Reason: " << warperResult.what();
+			return grpc::Status(grpc::INTERNAL, "Failed to create warped face. Reason: ");
+		}
+
+		if (warpDumper != nullptr)
+			warpDumper->capture(*warp, inputs.dumpRequestId, detectionIndex);
+	}
+
+	if (stages & StageWarp) {
+		LunaSDK::Image* warpImage = face_->mutable_warpiamge();
+		if (!FillWarpImage(*warp, options, warpImage)) {
+			metrics::CountError(metrics::Stage::Warp);
+			return grpc::Status(grpc::INTERNAL, "Failed to encode warped face.");
+		}
+	}
+
+	return grpc::Status::OK;
+}
+
+// Runs the estimation stages over the faces [first, first + count), one
+// estimator over all of them at a time.
+grpc::Status EstimateFaces(FaceEstimators& estimators, const FaceInputs& inputs, int first, int count,
+	const fsdk::Image* warps, LunaSDK::ImageProccessingResult* reply)
+{
+	const unsigned stages = inputs.stages;
+	const fsdk::Detection* detections = inputs.detections + first;
+	const CallControl& control = *inputs.control;
+	std::string error;
+
+	if (stages & StageAttributes) {
+		if (!control.canRun(metrics::Stage::Attributes, inputs.pipeline))
+			return control.stopStatus();
+		// Get attribute estimates.
+		std::vector<fsdk::AttributeEstimation> attributes(count);
+		{
+			metrics::StageTimer timer(metrics::Stage::Attributes);
+			if (!EstimateAttributes(estimators.attributeEstimator.get(), warps + first, count,
+				attributes.data(), &error)) {
+				metrics::CountError(metrics::Stage::Attributes);
+				LUNA_LOG(Error) << "Failed to create attribute estimation. Reason: " << error;
+				return grpc::Status(grpc::INTERNAL, "Failed to create attribute estimation. Reason: ");
+			}
+		}
+		for (const fsdk::AttributeEstimation& attributeEstimation : attributes) {
+			LUNA_LOG_SAMPLED(Debug) << "Attribute estimate:" <<
+				" gender: " << attributeEstimation.gender <<
+				" glasses: " << attributeEstimation.glasses <<
+				" age: " << attributeEstimation.age;
+		}
+	}
+
+	if (stages & StageQuality) {
+		if (!control.canRun(metrics::Stage::Quality, inputs.pipeline))
+			return control.stopStatus();
+		// Get quality estimates.
+		std::vector<fsdk::Quality> qualities(count);
+		{
+			metrics::StageTimer timer(metrics::Stage::Quality);
+			if (!EstimateQuality(estimators.qualityEstimator.get(), warps + first, count,
+				qualities.data(), &error)) {
+				metrics::CountError(metrics::Stage::Quality);
+				LUNA_LOG(Error) << "Failed to create quality estimation. Reason: " << error;
+				return grpc::Status(grpc::INTERNAL, "Failed to create quality estimation. Reason: ");
+			}
+		}
+		for (int i = 0; i < count; ++i) {
+			const fsdk::Quality& qualityEstimation = qualities[i];
+			LunaSDK::QualityFaceFountAttribute * Quality = reply->mutable_facefounts(first + i)->mutable_quality();
+			Quality->set_ligth(qualityEstimation.light);
+			Quality->set_dark(qualityEstimation.dark);
+			Quality->set_gray(qualityEstimation.gray);
+			Quality->set_blur(qualityEstimation.blur);
+			Quality->set_quality(qualityEstimation.getQuality());
+
+			LUNA_LOG_SAMPLED(Debug) << "Quality estimate:" <<
+				" light: " << qualityEstimation.light <<
+				" dark: " << qualityEstimation.dark <<
+				" gray: " << qualityEstimation.gray <<
+				" blur: " << qualityEstimation.blur <<
+				" quality: " << qualityEstimation.getQuality();
+		}
+	}
+
+	if (stages & StageHeadPose) {
+		if (!control.canRun(metrics::Stage::HeadPose, inputs.pipeline))
+			return control.stopStatus();
+		// Get head pose estimates.
+		std::vector<fsdk::HeadPoseEstimation> headPoses(count);
+		{
+			metrics::StageTimer timer(metrics::Stage::HeadPose);
+			if (!EstimateHeadPose(estimators.headPoseEstimator.get(), *inputs.image, detections, count,
+				headPoses.data(), &error)) {
+				metrics::CountError(metrics::Stage::HeadPose);
+				LUNA_LOG(Error) << "Failed to create head pose estimation. Reason: " << error;
+				return grpc::Status(grpc::INTERNAL, "Failed to create head pose estimation. Reason: ");
+			}
+		}
+		for (int i = 0; i < count; ++i) {
+			const fsdk::HeadPoseEstimation& headPoseEstimation = headPoses[i];
+			LunaSDK::HeadPoseFaceFountAttribute* HeadPose = reply->mutable_facefounts(first + i)->mutable_headpos();
+			HeadPose->set_pitch(headPoseEstimation.pitch);
+			HeadPose->set_yaw(headPoseEstimation.yaw);
+			HeadPose->set_roll(headPoseEstimation.roll);
+
+			LUNA_LOG_SAMPLED(Debug) << "Head pose estimate:" <<
+				" pitch: " << headPoseEstimation.pitch <<
+				" yaw: " << headPoseEstimation.yaw <<
+				" roll: " << headPoseEstimation.roll;
+		}
+	}
+
+	if (stages & StageOverlap) {
+		if (!control.canRun(metrics::Stage::Overlap, inputs.pipeline))
+			return control.stopStatus();
+		// Get overlap estimations.
+		std::vector<fsdk::OverlapEstimation> overlaps(count);
+		{
+			metrics::StageTimer timer(metrics::Stage::Overlap);
+			if (!EstimateOverlap(estimators.overlapEstimator.get(), *inputs.image, detections, count,
+				overlaps.data(), &error)) {
+				metrics::CountError(metrics::Stage::Overlap);
+				LUNA_LOG(Error) << "Failed overlap estimation. Reason: " << error;
+				return grpc::Status(grpc::INTERNAL, "Failed overlap estimation. Reason: ");
+			}
+		}
+		for (const fsdk::OverlapEstimation& overlapEstimation : overlaps) {
+			LUNA_LOG_SAMPLED(Debug) << "Face overlap estimate:"
+				<< " overlapValue: " << overlapEstimation.overlapValue
+				<< " overlapped: " << overlapEstimation.overlapped;
+		}
+	}
+
+	return grpc::Status::OK;
+}
+
+// Runs task for indexes below count on the face pool of estimators, or in
+// order on the calling thread when there is none.
+void RunFaceTasks(EstimatorSet& estimators, int count, const FacePool::Task& task)
+{
+	if (estimators.facePool != nullptr) {
+		estimators.facePool->run(count, estimators, task);
+		return;
+	}
+	for (int index = 0; index < count; ++index)
+		task(estimators, index);
+}
+
+}  // namespace
+
+ImageRequestView ViewOf(const LunaSDK::Image& request)
+{
+	ImageRequestView view;
+	view.width = request.width();
+	view.height = request.height();
+	view.data = request.image_data().data();
+	view.size = request.image_data().size();
+	view.format = request.format();
+	view.stride = request.stride();
+	view.encoding = request.encoding();
+	view.options = &request.options();
+	return view;
+}
+
+ResultKey ResultCacheKey(const ImageRequestView& request)
+{
+	ResultKey key;
+	if (request.options != nullptr)
+		request.options->SerializeToString(&key.fields);
+	const int32_t layout[] = { request.width, request.height, request.format, request.stride, request.encoding };
+	key.fields.append(reinterpret_cast<const char*>(layout), sizeof(layout));
+	key.data = request.data;
+	key.size = request.size;
+	key.hash = HashBytes(request.data, request.size, HashBytes(key.fields.data(), key.fields.size(), 0));
+	return key;
+}
+
+grpc::Status DecodeImage(const ImageRequestView& request, int jpegTargetSide, DecodedImage* decoded)
+{
+    //std::string prefix("Hello ");
+	metrics::CountRequest();
+    if(request.size == 0)
+		return grpc::Status(grpc::INVALID_ARGUMENT, "iamage_dat = 0");
+
+	//reply->set_message(prefix + request.name());
+	LUNA_LOG(Debug) << "Proccesing : Image len = " << request.size << " size = { H" << request.height << " : W" << request.width << "}";
+
+	// Facial feature detection confidence threshold.
+	//const float confidenceThreshold = 0.25f;
+
+	// Load image
+	metrics::StageTimer loadTimer(metrics::Stage::ImageLoad);
+	const bool raw = request.encoding == LunaSDK::ENCODING_RAW ||
+		(request.encoding == LunaSDK::ENCODING_UNSPECIFIED && request.format != LunaSDK::PIXEL_FORMAT_UNSPECIFIED);
+	fsdk::Image* image = &decoded->image;
+	decoded->toRequest = CoordinateTransform();
+	if (raw)
+		return LoadRawPixels(request, image);
+
+	const bool jpeg = request.encoding == LunaSDK::ENCODING_JPEG ||
+		(request.encoding == LunaSDK::ENCODING_UNSPECIFIED && LooksLikeJpeg(request.data, request.size));
+	if (jpeg) {
+		const JpegRowAllocator allocate = [image](int width, int height, int* rowStride) -> uint8_t* {
+			if (!image->create(width, height, fsdk::Format::R8G8B8))
+				return nullptr;
+			*rowStride = image->getRowSize();
+			return static_cast<uint8_t*>(image->getData());
+		};
+		int scaleDenom = 1;
+		if (!DecodeJpegRgb(request.data, request.size, jpegTargetSide, allocate, &scaleDenom)) {
+			metrics::CountError(metrics::Stage::ImageLoad);
+			LUNA_LOG(Error) << "Failed to decode JPEG";
+			return grpc::Status(grpc::INVALID_ARGUMENT, "Failed to decode JPEG");
+		}
+		decoded->toRequest.scaleX = decoded->toRequest.scaleY = static_cast<float>(scaleDenom);
+		LUNA_LOG(Debug) << "Decoded JPEG at 1/" << scaleDenom << " scale: "
+			<< image->getWidth() << "x" << image->getHeight();
+		return grpc::Status::OK;
+	}
+
+	if (!image->loadFromMemory(request.data, static_cast<uint32_t>(request.size), fsdk::Format::R8G8B8)) {
+		metrics::CountError(metrics::Stage::ImageLoad);
+		LUNA_LOG(Error) << "Failed to load image";
+		return grpc::Status(grpc::INTERNAL, "Failed to load image ");
+	}
+	return grpc::Status::OK;
+}
+
+grpc::Status ProcessDecodedImage(EstimatorSet& estimators, const DecodedImage& decoded,
+	const LunaSDK::ProcessingOptions& options, const CallControl& control,
+	LunaSDK::ImageProccessingResult* reply)
+{
+	const unsigned stages = RequestedStages(options);
+	const unsigned pipeline = PipelineOf(stages);
+	if (!control.canRun(metrics::Stage::Detect, pipeline))
+		return control.stopStatus();
+
+	const fsdk::Image& image = decoded.image;
+	const bool needWarp = (pipeline & StageBit(metrics::Stage::Warp)) != 0;
+	const uint64_t dumpRequestId = estimators.warpDumper ? estimators.warpDumper->nextRequestId() : 0;
+
+	LUNA_LOG(Debug) << "Detecting faces.";
+
+	// Return no more faces than the request asks for, within the server limit.
+	const PipelineSettings& settings = estimators.settings;
+	int maxFaces = options.maxfaces() > 0 ? options.maxfaces() : settings.defaultMaxFaces;
+	if (maxFaces > settings.maxFacesLimit)
+		maxFaces = settings.maxFacesLimit;
+
+	// Data used for detection, preallocated in the estimator set.
+	fsdk::Detection* detections = estimators.detections.data();
+	fsdk::Landmarks5* landmarks5 = estimators.landmarks5.data();
+	// The 68 landmarks cost extra detector work, so they are only asked
+	// for when returned.
+	fsdk::Landmarks68* landmarks68 = (stages & StageLandmarks68) ? estimators.landmarks68.data() : nullptr;
+
+	// Minimum face size in image pixels.
+	const float toImageScale = std::min(decoded.toRequest.scaleX, decoded.toRequest.scaleY);
+	const float minFaceSize = options.minfacesize() > 0 ? options.minfacesize() / toImageScale : 0.0f;
+
+	// Faces failing the score and size filters must not take the slots of
+	// ones passing them, so with a filter the detector fills the whole
+	// buffer and the result is cut to maxFaces after filtering.
+	const bool filtered = options.scorethreshold() > 0 || minFaceSize > 0;
+	int detectionsCount = filtered ? settings.maxFacesLimit : maxFaces;
+
+	// Detect faces in the image, or in a smaller pyramid level of it.
+	std::string detectorError;
+	{
+		metrics::StageTimer timer(metrics::Stage::Detect);
+		fsdk::Image level;
+		CoordinateTransform levelToImage;
+		const int factor = DetectionLevelFactor(image.getWidth(), image.getHeight(), settings.detectMaxSide,
+			minFaceSize, settings.detectorMinFace);
+		const bool useLevel = BuildDetectionLevel(image, factor, &level, &levelToImage);
+		const fsdk::Image& detectImage = useLevel ? level : image;
+		const CoordinateTransform requestToDetect = decoded.toRequest.inverse().then(levelToImage.inverse());
+		detectionsCount = DetectFaces(estimators, detectImage, options.detectregions(), requestToDetect,
+			detections, landmarks5, landmarks68, detectionsCount, &detectorError);
+		// Everything after detection works on the full image.
+		for (int i = 0; useLevel && i < detectionsCount; ++i) {
+			levelToImage.apply(&detections[i]);
+			levelToImage.apply(&landmarks5[i]);
+			if (landmarks68)
+				levelToImage.apply(&landmarks68[i]);
+		}
+		detectionsCount = DropFaces(options.scorethreshold(), minFaceSize, detections, landmarks5,
+			landmarks68, detectionsCount);
+		if (detectionsCount > maxFaces)
+			detectionsCount = maxFaces;
+	}
+
+	if (detectionsCount < 0) {
+		metrics::CountError(metrics::Stage::Detect);
+		LUNA_LOG(Error) << "Failed to detect face detection. Reason: " << detectorError;
+		return grpc::Status(grpc::INTERNAL, "Failed to detect face detection.");
+	}
+
+	metrics::CountFaces(detectionsCount);
+	if (detectionsCount == 0) {
+		LUNA_LOG(Debug) << "Faces is not found.";
+		return grpc::Status::OK;
+	}
+	LUNA_LOG(Debug) << "Found " << detectionsCount << " face(s).";
+
+	// Reply slots are added up front in detection order, so the faces can
+	// be filled in by any thread.
+	for (int detectionIndex = 0; detectionIndex < detectionsCount; ++detectionIndex)
+		reply->add_facefounts();
+
+	FaceInputs inputs;
+	inputs.image = &image;
+	inputs.toRequest = &decoded.toRequest;
+	inputs.detections = detections;
+	inputs.landmarks5 = landmarks5;
+	inputs.landmarks68 = landmarks68;
+	inputs.options = &options;
+	inputs.stages = stages;
+	inputs.needWarp = needWarp;
+	inputs.pipeline = pipeline;
+	inputs.warpDumper = estimators.warpDumper;
+	inputs.dumpRequestId = dumpRequestId;
+	inputs.control = &control;
+
+	// Warp each face, then estimate in contiguous runs of faces so every
+	// estimator goes over its run in one go. Both phases are spread over
+	// the face pool when there is one.
+	std::vector<fsdk::Image> warps(detectionsCount);
+	std::vector<grpc::Status> statuses(detectionsCount);
+	const FacePool::Task warpTask = [&](FaceEstimators& faceEstimators, int detectionIndex) {
+		statuses[detectionIndex] = WarpFace(faceEstimators, inputs, detectionIndex,
+			reply->mutable_facefounts(detectionIndex), &warps[detectionIndex]);
+	};
+	RunFaceTasks(estimators, detectionsCount, warpTask);
+	for (const grpc::Status& status : statuses) {
+		if (!status.ok())
+			return status;
+	}
+
+	const int runs = estimators.facePool != nullptr ?
+		std::min(detectionsCount, estimators.facePool->threads() + 1) : 1;
+	const int runLength = (detectionsCount + runs - 1) / runs;
+	const FacePool::Task estimateTask = [&](FaceEstimators& faceEstimators, int run) {
+		const int first = run * runLength;
+		const int count = std::min(runLength, detectionsCount - first);
+		statuses[run] = count > 0 ?
+			EstimateFaces(faceEstimators, inputs, first, count, warps.data(), reply) : grpc::Status::OK;
+	};
+	RunFaceTasks(estimators, runs, estimateTask);
+	for (int run = 0; run < runs; ++run) {
+		if (!statuses[run].ok())
+			return statuses[run];
+	}
+	return grpc::Status::OK;
+}
+
+grpc::Status ProcessImage(EstimatorSet& estimators, const ImageRequestView& request,
+	const CallControl& control, LunaSDK::ImageProccessingResult* reply)
+{
+	// Work that waited too long in a queue is dropped before decoding.
+	if (!control.canRun(metrics::Stage::ImageLoad, PipelineOf(RequestedStages(*request.options))))
+		return control.stopStatus();
+	DecodedImage decoded;
+	grpc::Status status = DecodeImage(request, estimators.settings.jpegTargetSide, &decoded);
+	if (!status.ok())
+		return status;
+	return ProcessDecodedImage(estimators, decoded, *request.options, control, reply);
+}
+
+grpc::Status ProcessImage(EstimatorSet& estimators, const LunaSDK::Image& request,
+	const CallControl& control, LunaSDK::ImageProccessingResult* reply)
+{
+	return ProcessImage(estimators, ViewOf(request), control, reply);
+}
+
+namespace {
+
+// A frame decoded ahead of processing. Raw RGB frames reference the
+// request's pixels, so the request travels with its image.
+struct DecodedFrame {
+	std::unique_ptr<LunaSDK::Image> request;
+	DecodedImage image;
+	grpc::Status status;
+};
+
+// Frames decoded ahead of the one being processed.
+enum { StreamDecodeDepth = 2 };
+
+}  // namespace
+
+grpc::Status ProcessImageStream(EstimatorSet& estimators, grpc::ServerContext* context,
+	grpc::ServerReaderWriterInterface<LunaSDK::ImageProccessingResult, LunaSDK::Image>* stream)
+{
+	// Reading and decoding the next frames overlaps with detection and
+	// estimation of the current one.
+	BoundedQueue<DecodedFrame> decoded(StreamDecodeDepth);
+	const int jpegTargetSide = estimators.settings.jpegTargetSide;
+	std::thread reader([stream, &decoded, jpegTargetSide] {
+		while (true) {
+			DecodedFrame frame;
+			frame.request.reset(new LunaSDK::Image());
+			if (!stream->Read(frame.request.get()))
+				break;
+			frame.status = DecodeImage(ViewOf(*frame.request), jpegTargetSide, &frame.image);
+			if (!decoded.push(std::move(frame)))
+				break;
+		}
+		decoded.close();
+	});
+
+	const CallControl control(context, true);
+	grpc::Status status;
+	DecodedFrame frame;
+	LunaSDK::ImageProccessingResult reply;
+	while (decoded.pop(&frame)) {
+		status = frame.status;
+		if (status.ok()) {
+			reply.Clear();
+			status = ProcessDecodedImage(estimators, frame.image, frame.request->options(), control, &reply);
+		}
+		if (!status.ok())
+			break;
+		// The client has gone away.
+		if (!stream->Write(reply))
+			break;
+	}
+
+	// Unblock the reader if it is still waiting for frames or for room.
+	if (!status.ok())
+		context->TryCancel();
+	decoded.close();
+	reader.join();
+	return status;
+}
+
+grpc::Status OverloadedStatus()
+{
+	LUNA_LOG_SAMPLED(Warning) << "Admission queue full, rejecting call";
+	return grpc::Status(grpc::RESOURCE_EXHAUSTED, "Server is overloaded, retry later.");
+}
+
+grpc::Status ProcessImageBatch(EstimatorPool& pool, WorkerPool& workers,
+	const LunaSDK::ImageBatch& request, const CallControl& control,
+	std::chrono::steady_clock::time_point admitted, LunaSDK::ImageBatchResult* reply)
+{
+	const int count = request.images_size();
+
+	// Add all entries up front so workers only touch their own message.
+	for (int i = 0; i < count; ++i)
+		reply->add_results()->set_id_request(request.images(i).id_request());
+
+	std::mutex mutex;
+	std::condition_variable finished;
+	int remaining = count;
+	for (int i = 0; i < count; ++i) {
+		LunaSDK::ImageBatchItemResult* item = reply->mutable_results(i);
+		const LunaSDK::Image* image = &request.images(i).photo();
+		workers.submit([&pool, &control, admitted, &mutex, &finished, &remaining, item, image] {
+			grpc::Status status;
+			{
+				EstimatorPool::Lease estimators = pool.acquire(control.deadline(), control.lane());
+				metrics::RecordQueueWait(std::chrono::steady_clock::now() - admitted);
+				status = ProcessImage(*estimators, *image, control, item->mutable_result());
+			}
+			if (!status.ok()) {
+				item->set_errorcode(status.error_code());
+				item->set_errormessage(status.error_message());
+				item->clear_result();
+			}
+
+			std::lock_guard<std::mutex> lock(mutex);
+			if (--remaining == 0)
+				finished.notify_one();
+		}, control.deadline(), control.lane());
+	}
+
+	std::unique_lock<std::mutex> lock(mutex);
+	finished.wait(lock, [&remaining] { return remaining == 0; });
+	return grpc::Status::OK;
+}
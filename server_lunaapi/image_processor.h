@@ -0,0 +1,98 @@
+#ifndef LUNAAPI_IMAGE_PROCESSOR_H
+#define LUNAAPI_IMAGE_PROCESSOR_H
+
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/impl/codegen/sync_stream.h>
+
+#include "call_control.h"
+#include "coordinate_transform.h"
+#include "estimator_pool.h"
+#include "result_cache.h"
+#include "test_api.pb.h"
+#include "worker_pool.h"
+
+// Per-face stages selected by ProcessingOptions.Stages.
+enum StageBits : unsigned {
+	StageWarp = 1u << 0,
+	StageAttributes = 1u << 1,
+	StageQuality = 1u << 2,
+	StageHeadPose = 1u << 3,
+	StageOverlap = 1u << 4,
+	StageLandmarks5 = 1u << 5,
+	StageLandmarks68 = 1u << 6,
+	StageAll = StageWarp | StageAttributes | StageQuality | StageHeadPose | StageOverlap,
+};
+
+// Converts the request stage list to StageBits; empty selects StageAll,
+// which leaves out the landmark outputs.
+unsigned RequestedStages(const LunaSDK::ProcessingOptions& options);
+
+// Request fields the pipeline reads, pointing either into a parsed
+// LunaSDK::Image or straight into received transport buffers.
+struct ImageRequestView {
+	int width = 0;
+	int height = 0;
+	const void* data = nullptr;
+	size_t size = 0;
+	LunaSDK::PixelFormat format = LunaSDK::PIXEL_FORMAT_UNSPECIFIED;
+	int stride = 0;
+	LunaSDK::ImageEncoding encoding = LunaSDK::ENCODING_UNSPECIFIED;
+	const LunaSDK::ProcessingOptions* options = nullptr;
+};
+
+ImageRequestView ViewOf(const LunaSDK::Image& request);
+
+// Key of a request in the ResultCache: its image bytes and every request
+// field the result depends on. Refers to request.data.
+ResultKey ResultCacheKey(const ImageRequestView& request);
+
+// Pixels of a request, possibly at reduced resolution.
+struct DecodedImage {
+	fsdk::Image image;
+	// From image to request coordinates; scales up when a JPEG was decoded
+	// at a reduced DCT scale.
+	CoordinateTransform toRequest;
+};
+
+// Validates the request and loads its pixels as R8G8B8. Compressed images
+// are decoded, other raw layouts converted, and packed RGB frames are used
+// in place: the image may then point into request.data, which must outlive
+// it. JPEGs are decoded at reduced size when they are larger than
+// jpegTargetSide (see DecodeJpegRgb); 0 always decodes at full size.
+grpc::Status DecodeImage(const ImageRequestView& request, int jpegTargetSide, DecodedImage* decoded);
+
+// Runs detection and the per-face stages selected in options on a loaded
+// image and fills the reply in request coordinates. Detection runs on a
+// reduced pyramid level when the image is larger than
+// estimators.detectMaxSide; warps and estimates always use the full image.
+// Stops with control.stopStatus() before any stage control turns down.
+grpc::Status ProcessDecodedImage(EstimatorSet& estimators, const DecodedImage& decoded,
+	const LunaSDK::ProcessingOptions& options, const CallControl& control,
+	LunaSDK::ImageProccessingResult* reply);
+
+// DecodeImage followed by ProcessDecodedImage. Shared by all server modes;
+// the caller owns the estimator set.
+grpc::Status ProcessImage(EstimatorSet& estimators, const ImageRequestView& request,
+	const CallControl& control, LunaSDK::ImageProccessingResult* reply);
+grpc::Status ProcessImage(EstimatorSet& estimators, const LunaSDK::Image& request,
+	const CallControl& control, LunaSDK::ImageProccessingResult* reply);
+
+// Serves a ProcessStream call on one estimator set, writing a result per
+// frame. Decoding runs one frame ahead on a reader thread. A failing frame
+// ends the stream with its status and cancels the rest of the call.
+grpc::Status ProcessImageStream(EstimatorSet& estimators, grpc::ServerContext* context,
+	grpc::ServerReaderWriterInterface<LunaSDK::ImageProccessingResult, LunaSDK::Image>* stream);
+
+// Rejection of a call turned away by the admission queue.
+grpc::Status OverloadedStatus();
+
+// Serves a ProcessBatch call: every image is processed on the worker pool
+// with its own estimator set, and the call returns when all are done.
+// Failures are reported per image, so one bad image does not fail the batch.
+// Images queue for workers and estimator sets by the deadline of control;
+// each records its queue wait from admitted, when the call was admitted.
+grpc::Status ProcessImageBatch(EstimatorPool& pool, WorkerPool& workers,
+	const LunaSDK::ImageBatch& request, const CallControl& control,
+	std::chrono::steady_clock::time_point admitted, LunaSDK::ImageBatchResult* reply);
+
+#endif  // LUNAAPI_IMAGE_PROCESSOR_H
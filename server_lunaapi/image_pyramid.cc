@@ -0,0 +1,65 @@
+#include "image_pyramid.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// Pyramid levels coarser than 1/8 lose too much of the small faces.
+enum { MaxFactor = 8 };
+
+void BoxDownscale(const uint8_t* src, int srcStride, int factor, int width, int height,
+	uint8_t* dst, int dstStride) {
+	const int rowValues = width * 3;
+	const uint32_t area = static_cast<uint32_t>(factor) * factor;
+	std::vector<uint32_t> sums(rowValues);
+	for (int y = 0; y < height; ++y) {
+		std::fill(sums.begin(), sums.end(), 0u);
+		for (int dy = 0; dy < factor; ++dy) {
+			const uint8_t* in = src + static_cast<size_t>(y * factor + dy) * srcStride;
+			for (int x = 0; x < width; ++x) {
+				uint32_t* sum = &sums[x * 3];
+				for (int dx = 0; dx < factor; ++dx, in += 3) {
+					sum[0] += in[0];
+					sum[1] += in[1];
+					sum[2] += in[2];
+				}
+			}
+		}
+		uint8_t* out = dst + static_cast<size_t>(y) * dstStride;
+		for (int i = 0; i < rowValues; ++i)
+			out[i] = static_cast<uint8_t>((sums[i] + area / 2) / area);
+	}
+}
+
+}  // namespace
+
+int DetectionLevelFactor(int width, int height, int maxSide, float minFaceSize, int detectorMinFace) {
+	const int longer = width > height ? width : height;
+	int factor = 1;
+	while (maxSide > 0 && longer / factor > maxSide && factor < MaxFactor)
+		factor *= 2;
+	while (detectorMinFace > 0 && minFaceSize / (factor * 2) >= detectorMinFace && factor < MaxFactor)
+		factor *= 2;
+	return factor;
+}
+
+bool BuildDetectionLevel(const fsdk::Image& image, int factor, fsdk::Image* level,
+	CoordinateTransform* toImage) {
+	if (factor <= 1 || image.getFormat() != fsdk::Format::R8G8B8)
+		return false;
+	const int width = image.getWidth();
+	const int height = image.getHeight();
+
+	// Trailing pixels that do not fill a block are dropped.
+	const int levelWidth = width / factor;
+	const int levelHeight = height / factor;
+	if (levelWidth == 0 || levelHeight == 0 || !level->create(levelWidth, levelHeight, fsdk::Format::R8G8B8))
+		return false;
+	BoxDownscale(static_cast<const uint8_t*>(image.getData()), image.getRowSize(), factor,
+		levelWidth, levelHeight, static_cast<uint8_t*>(level->getData()), level->getRowSize());
+	toImage->scaleX = static_cast<float>(factor);
+	toImage->scaleY = static_cast<float>(factor);
+	return true;
+}
@@ -0,0 +1,22 @@
+#ifndef LUNAAPI_IMAGE_PYRAMID_H
+#define LUNAAPI_IMAGE_PYRAMID_H
+
+#include <fsdk/FaceEngine.h>
+
+#include "coordinate_transform.h"
+
+// Power-of-two reduction (1 to 8) of a width x height image for detection.
+// It is the smallest one bringing the longer side to at most maxSide, or
+// larger when faces of minFaceSize pixels still measure detectorMinFace
+// after it, as the detector would only search the finer levels for
+// smaller faces. Zero disables either bound.
+int DetectionLevelFactor(int width, int height, int maxSide, float minFaceSize, int detectorMinFace);
+
+// Builds the pyramid level of an R8G8B8 image reduced by factor, averaging
+// each factor x factor block in a single pass. Returns false, leaving level
+// untouched, when factor is 1 or the image cannot be reduced. toImage maps
+// level coordinates back to image coordinates.
+bool BuildDetectionLevel(const fsdk::Image& image, int factor, fsdk::Image* level,
+	CoordinateTransform* toImage);
+
+#endif  // LUNAAPI_IMAGE_PYRAMID_H
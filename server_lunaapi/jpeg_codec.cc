@@ -0,0 +1,156 @@
+#include "jpeg_codec.h"
+
+#include <csetjmp>
+#include <cstdio>
+
+#include <jpeglib.h>
+
+#include "logger.h"
+
+namespace {
+
+// Reports libjpeg errors through the logger and unwinds with longjmp
+// instead of the library default of calling exit().
+struct ErrorManager {
+	jpeg_error_mgr base;
+	std::jmp_buf unwind;
+};
+
+void ErrorExit(j_common_ptr info) {
+	ErrorManager* errors = reinterpret_cast<ErrorManager*>(info->err);
+	char message[JMSG_LENGTH_MAX];
+	(*info->err->format_message)(info, message);
+	LUNA_LOG(Warning) << "JPEG error: " << message;
+	std::longjmp(errors->unwind, 1);
+}
+
+// Warnings (e.g. a truncated scan) go to the logger instead of stderr.
+void OutputMessage(j_common_ptr info) {
+	char message[JMSG_LENGTH_MAX];
+	(*info->err->format_message)(info, message);
+	LUNA_LOG(Warning) << "JPEG warning: " << message;
+}
+
+// Destination that grows a std::string, so compressed bytes land in their
+// final buffer without an intermediate copy.
+struct StringDestination {
+	jpeg_destination_mgr base;
+	std::string* out;
+};
+
+void InitDestination(j_compress_ptr info) {
+	StringDestination* destination = reinterpret_cast<StringDestination*>(info->dest);
+	destination->base.next_output_byte = reinterpret_cast<JOCTET*>(&(*destination->out)[0]);
+	destination->base.free_in_buffer = destination->out->size();
+}
+
+boolean EmptyOutputBuffer(j_compress_ptr info) {
+	StringDestination* destination = reinterpret_cast<StringDestination*>(info->dest);
+	// libjpeg only calls this when the whole buffer is full.
+	const size_t used = destination->out->size();
+	destination->out->resize(used * 2);
+	destination->base.next_output_byte = reinterpret_cast<JOCTET*>(&(*destination->out)[used]);
+	destination->base.free_in_buffer = destination->out->size() - used;
+	return TRUE;
+}
+
+void TermDestination(j_compress_ptr info) {
+	StringDestination* destination = reinterpret_cast<StringDestination*>(info->dest);
+	destination->out->resize(destination->out->size() - destination->base.free_in_buffer);
+}
+
+// Largest supported denominator keeping the longer side >= minSide.
+int ChooseScaleDenom(int width, int height, int minSide) {
+	if (minSide <= 0)
+		return 1;
+	const int longer = width > height ? width : height;
+	for (int denom = 8; denom > 1; denom /= 2) {
+		if ((longer + denom - 1) / denom >= minSide)
+			return denom;
+	}
+	return 1;
+}
+
+}  // namespace
+
+bool LooksLikeJpeg(const void* data, size_t size) {
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	return size >= 3 && bytes[0] == 0xff && bytes[1] == 0xd8 && bytes[2] == 0xff;
+}
+
+bool DecodeJpegRgb(const void* data, size_t size, int minSide, const JpegRowAllocator& allocate,
+	int* scaleDenom) {
+	jpeg_decompress_struct info;
+	ErrorManager errors;
+	info.err = jpeg_std_error(&errors.base);
+	errors.base.error_exit = ErrorExit;
+	errors.base.output_message = OutputMessage;
+	if (setjmp(errors.unwind)) {
+		jpeg_destroy_decompress(&info);
+		return false;
+	}
+	jpeg_create_decompress(&info);
+	jpeg_mem_src(&info, static_cast<const unsigned char*>(data), static_cast<unsigned long>(size));
+	jpeg_read_header(&info, TRUE);
+
+	*scaleDenom = ChooseScaleDenom(info.image_width, info.image_height, minSide);
+	info.out_color_space = JCS_RGB;
+	info.scale_num = 1;
+	info.scale_denom = *scaleDenom;
+	// The accurate IDCT and fancy upsampling are kept at every scale: the
+	// decoded pixels feed the warps and estimators, not just detection.
+	jpeg_start_decompress(&info);
+
+	int rowStride = 0;
+	uint8_t* pixels = allocate(info.output_width, info.output_height, &rowStride);
+	if (pixels == nullptr || info.output_components != 3) {
+		jpeg_destroy_decompress(&info);
+		return false;
+	}
+	while (info.output_scanline < info.output_height) {
+		JSAMPROW row = pixels + static_cast<size_t>(info.output_scanline) * rowStride;
+		jpeg_read_scanlines(&info, &row, 1);
+	}
+	jpeg_finish_decompress(&info);
+	jpeg_destroy_decompress(&info);
+	return true;
+}
+
+bool EncodeJpegRgb(const uint8_t* pixels, int width, int height, int rowStride,
+	int quality, std::string* out) {
+	jpeg_compress_struct info;
+	ErrorManager errors;
+	info.err = jpeg_std_error(&errors.base);
+	errors.base.error_exit = ErrorExit;
+	errors.base.output_message = OutputMessage;
+	if (setjmp(errors.unwind)) {
+		jpeg_destroy_compress(&info);
+		out->clear();
+		return false;
+	}
+	jpeg_create_compress(&info);
+
+	// A quarter of the raw size is plenty for typical face crops.
+	out->resize(static_cast<size_t>(width) * height * 3 / 4 + 1024);
+	StringDestination destination;
+	destination.base.init_destination = InitDestination;
+	destination.base.empty_output_buffer = EmptyOutputBuffer;
+	destination.base.term_destination = TermDestination;
+	destination.out = out;
+	info.dest = &destination.base;
+
+	info.image_width = width;
+	info.image_height = height;
+	info.input_components = 3;
+	info.in_color_space = JCS_RGB;
+	jpeg_set_defaults(&info);
+	jpeg_set_quality(&info, quality, TRUE);
+	jpeg_start_compress(&info, TRUE);
+	while (info.next_scanline < info.image_height) {
+		JSAMPROW row = const_cast<JSAMPROW>(pixels + static_cast<size_t>(info.next_scanline) * rowStride);
+		jpeg_write_scanlines(&info, &row, 1);
+	}
+	jpeg_finish_compress(&info);
+	jpeg_destroy_compress(&info);
+	return true;
+}
@@ -0,0 +1,29 @@
+#ifndef LUNAAPI_JPEG_CODEC_H
+#define LUNAAPI_JPEG_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// Compresses packed 8-bit RGB rows (rowStride bytes apart) to JPEG,
+// writing straight into out. Returns false and leaves out empty on failure.
+bool EncodeJpegRgb(const uint8_t* pixels, int width, int height, int rowStride,
+	int quality, std::string* out);
+
+// Returns where rows of a width x height RGB image go, and their stride;
+// nullptr aborts decoding.
+typedef std::function<uint8_t*(int width, int height, int* rowStride)> JpegRowAllocator;
+
+// True if data starts with a JPEG SOI marker.
+bool LooksLikeJpeg(const void* data, size_t size);
+
+// Decompresses a JPEG to packed 8-bit RGB. When minSide is positive the
+// image is scaled down in the DCT domain by the largest of 1/2, 1/4 and
+// 1/8 that keeps its longer side at least minSide, which skips most of the
+// IDCT and upsampling work. scaleDenom receives the factor used (1 when
+// not scaled). Returns false on corrupt data or when allocate fails.
+bool DecodeJpegRgb(const void* data, size_t size, int minSide, const JpegRowAllocator& allocate,
+	int* scaleDenom);
+
+#endif  // LUNAAPI_JPEG_CODEC_H
@@ -0,0 +1,180 @@
+#include "logger.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace logging {
+
+std::atomic<int> g_minLevel{static_cast<int>(LogLevel::Info)};
+std::atomic<unsigned> g_sampleEvery{1};
+
+namespace {
+
+struct Record {
+	LogLevel level;
+	uint16_t length;
+	std::chrono::system_clock::time_point time;
+	char text[MaxMessageLength];
+};
+
+// Single-producer single-consumer ring owned by one logging thread.
+struct Ring {
+	enum { Capacity = 1024 };
+
+	Record records[Capacity];
+	std::atomic<size_t> head{0};  // next record to flush
+	std::atomic<size_t> tail{0};  // next free slot
+	std::atomic<bool> abandoned{false};
+	std::atomic<size_t> dropped{0};
+};
+
+std::mutex g_ringsMutex;
+std::vector<std::unique_ptr<Ring>> g_rings;
+
+// Marks the thread's ring for release by the flusher when the thread exits.
+struct RingOwner {
+	Ring* ring = nullptr;
+	~RingOwner() {
+		if (ring != nullptr)
+			ring->abandoned.store(true, std::memory_order_release);
+	}
+};
+
+thread_local RingOwner t_ringOwner;
+
+Ring* ThreadRing() {
+	if (t_ringOwner.ring == nullptr) {
+		std::unique_ptr<Ring> ring(new Ring());
+		t_ringOwner.ring = ring.get();
+		std::lock_guard<std::mutex> lock(g_ringsMutex);
+		g_rings.push_back(std::move(ring));
+	}
+	return t_ringOwner.ring;
+}
+
+const char LevelLetters[] = { 'D', 'I', 'W', 'E' };
+
+std::mutex g_flusherMutex;
+std::condition_variable g_flusherWakeup;
+bool g_stopping = false;
+std::thread g_flusher;
+
+// Appends "L HH:MM:SS.uuuuuu text\n" to out.
+void Format(const Record& record, std::string* out) {
+	const std::time_t seconds = std::chrono::system_clock::to_time_t(record.time);
+	const long micros = static_cast<long>(std::chrono::duration_cast<std::chrono::microseconds>(
+		record.time.time_since_epoch()).count() % 1000000);
+	std::tm local;
+	localtime_r(&seconds, &local);
+	char prefix[32];
+	const int length = std::snprintf(prefix, sizeof(prefix), "%c %02d:%02d:%02d.%06ld ",
+		LevelLetters[static_cast<int>(record.level)], local.tm_hour, local.tm_min, local.tm_sec, micros);
+	out->append(prefix, length);
+	out->append(record.text, record.length);
+	out->push_back('\n');
+}
+
+// Writes out everything buffered so far. Only called from one thread at a time.
+void Drain(std::string* out) {
+	std::unique_lock<std::mutex> lock(g_ringsMutex);
+	for (auto it = g_rings.begin(); it != g_rings.end();) {
+		Ring& ring = **it;
+		const bool abandoned = ring.abandoned.load(std::memory_order_acquire);
+		size_t head = ring.head.load(std::memory_order_relaxed);
+		const size_t tail = ring.tail.load(std::memory_order_acquire);
+		for (; head != tail; ++head)
+			Format(ring.records[head % Ring::Capacity], out);
+		ring.head.store(head, std::memory_order_release);
+
+		const size_t dropped = ring.dropped.exchange(0, std::memory_order_relaxed);
+		if (dropped > 0)
+			out->append("W log buffer full, dropped " + std::to_string(dropped) + " message(s)\n");
+
+		if (abandoned)
+			it = g_rings.erase(it);
+		else
+			++it;
+	}
+	lock.unlock();
+
+	if (!out->empty()) {
+		std::fwrite(out->data(), 1, out->size(), stderr);
+		std::fflush(stderr);
+		out->clear();
+	}
+}
+
+void RunFlusher() {
+	std::string out;
+	std::unique_lock<std::mutex> lock(g_flusherMutex);
+	while (!g_stopping) {
+		g_flusherWakeup.wait_for(lock, std::chrono::milliseconds(20));
+		lock.unlock();
+		Drain(&out);
+		lock.lock();
+	}
+	lock.unlock();
+	Drain(&out);
+}
+
+void Push(LogLevel level, const char* text, size_t length) {
+	Ring* ring = ThreadRing();
+	const size_t tail = ring->tail.load(std::memory_order_relaxed);
+	if (tail - ring->head.load(std::memory_order_acquire) >= Ring::Capacity) {
+		ring->dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	Record& record = ring->records[tail % Ring::Capacity];
+	record.level = level;
+	record.time = std::chrono::system_clock::now();
+	record.length = static_cast<uint16_t>(length);
+	std::memcpy(record.text, text, length);
+	ring->tail.store(tail + 1, std::memory_order_release);
+}
+
+}  // namespace
+
+bool ParseLevel(const char* text, LogLevel* level) {
+	static const char* const names[] = { "debug", "info", "warning", "error", "off" };
+	for (int i = 0; i <= static_cast<int>(LogLevel::Off); ++i) {
+		if (std::strcmp(text, names[i]) == 0) {
+			*level = static_cast<LogLevel>(i);
+			return true;
+		}
+	}
+	return false;
+}
+
+Session::Session(LogLevel level, unsigned sampleEvery) {
+	g_minLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+	g_sampleEvery.store(sampleEvery, std::memory_order_relaxed);
+	g_flusher = std::thread(RunFlusher);
+}
+
+Session::~Session() {
+	{
+		std::lock_guard<std::mutex> lock(g_flusherMutex);
+		g_stopping = true;
+	}
+	g_flusherWakeup.notify_one();
+	g_flusher.join();
+}
+
+Message::Message(LogLevel level)
+	: level_(level), buffer_(text_, text_ + MaxMessageLength), stream_(&buffer_) {
+}
+
+Message::~Message() {
+	Push(level_, text_, buffer_.length());
+}
+
+}  // namespace logging
@@ -0,0 +1,94 @@
+#ifndef LUNAAPI_LOGGER_H
+#define LUNAAPI_LOGGER_H
+
+#include <atomic>
+#include <ostream>
+#include <streambuf>
+
+// Leveled logging for the request path. Each thread appends formatted
+// records to its own lock-free ring buffer and a background thread writes
+// them out, so logging never takes a lock or flushes on the caller's
+// thread. A disabled statement costs one relaxed load and a branch; its
+// arguments are not evaluated.
+//
+//   LUNA_LOG(Info) << "Found " << count << " face(s).";
+//   LUNA_LOG_SAMPLED(Debug) << "per-face detail";  // 1 in --log_sample
+enum class LogLevel { Debug, Info, Warning, Error, Off };
+
+namespace logging {
+
+// Longer messages are truncated.
+enum { MaxMessageLength = 240 };
+
+extern std::atomic<int> g_minLevel;
+extern std::atomic<unsigned> g_sampleEvery;
+
+inline bool Enabled(LogLevel level) {
+	return static_cast<int>(level) >= g_minLevel.load(std::memory_order_relaxed);
+}
+
+// True for one in every g_sampleEvery calls with the same counter.
+inline bool Sample(std::atomic<unsigned>& counter) {
+	const unsigned every = g_sampleEvery.load(std::memory_order_relaxed);
+	return every <= 1 || counter.fetch_add(1, std::memory_order_relaxed) % every == 0;
+}
+
+// Parses debug|info|warning|error|off.
+bool ParseLevel(const char* text, LogLevel* level);
+
+// Starts the flusher thread. On destruction writes out what is buffered
+// and stops it.
+class Session {
+ public:
+	Session(LogLevel level, unsigned sampleEvery);
+	~Session();
+
+ private:
+	Session(const Session&) = delete;
+	Session& operator=(const Session&) = delete;
+};
+
+// Formats one record into a fixed buffer and queues it on destruction.
+class Message {
+ public:
+	explicit Message(LogLevel level);
+	~Message();
+
+	std::ostream& stream() { return stream_; }
+
+ private:
+	class Buffer : public std::streambuf {
+	 public:
+		Buffer(char* begin, char* end) { setp(begin, end); }
+		size_t length() const { return pptr() - pbase(); }
+	};
+
+	Message(const Message&) = delete;
+	Message& operator=(const Message&) = delete;
+
+	LogLevel level_;
+	char text_[MaxMessageLength];
+	Buffer buffer_;
+	std::ostream stream_;
+};
+
+// Turns the streamed expression into void so it can be a ?: branch; this
+// keeps the macros safe inside unbraced if/else.
+struct Voidify {
+	void operator&(std::ostream&) {}
+};
+
+}  // namespace logging
+
+#define LUNA_LOG(level) \
+	!logging::Enabled(LogLevel::level) ? (void)0 : \
+	logging::Voidify() & logging::Message(LogLevel::level).stream()
+
+// The lambda gives every call site its own sampling counter.
+#define LUNA_LOG_SAMPLED(level) \
+	(!logging::Enabled(LogLevel::level) || \
+	 !logging::Sample([]() -> std::atomic<unsigned>& { \
+		static std::atomic<unsigned> counter{0}; return counter; }())) ? (void)0 : \
+	logging::Voidify() & logging::Message(LogLevel::level).stream()
+
+#endif  // LUNAAPI_LOGGER_H
@@ -1,6 +1,36 @@
 #include <fsdk/FaceEngine.h>
 
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "color_convert.h"
+
+// Loads an uncompressed camera frame and converts it to R8G8B8. A stride
+// of 0 means rows are packed.
+static bool loadRawFrame(const char* path, int width, int height, PixelLayout layout, int stride,
+    fsdk::Image& image)
+{
+    if (width <= 0 || height <= 0 || width > MaxFrameSide || height > MaxFrameSide)
+        return false;
+    const int minStride = static_cast<int>(MinRowStride(layout, width));
+    if (stride == 0)
+        stride = minStride;
+    if (stride < minStride || stride > MaxRowStride)
+        return false;
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<uint8_t> frame((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (!file.eof() || frame.size() < FrameBytes(layout, width, height, stride))
+        return false;
+    if (!image.create(width, height, fsdk::Format::R8G8B8))
+        return false;
+    ConvertToRgb(layout, frame.data(), width, height, stride,
+        static_cast<uint8_t*>(image.getData()), image.getRowSize());
+    return true;
+}
 
 int main(int argc, char *argv[])
 {
@@ -10,14 +40,31 @@ int main(int argc, char *argv[])
     // Parse command line arguments.
     // Arguments:
     // 1) path to a first image.
-    // Image should be in ppm format.
-    if (argc != 2) {
-        std::cout << "USAGE: " << argv[0] << " <image>\n"
+    // Image should be in ppm format, or a raw frame described by
+    // 2) width, 3) height, 4) pixel format and optionally 5) row stride.
+    // May be preceded by --max_faces=<n>.
+    const char* program = argv[0];
+    int maxDetections = 10;
+    if (argc > 1 && std::strncmp(argv[1], "--max_faces=", 12) == 0) {
+        maxDetections = std::atoi(argv[1] + 12);
+        --argc;
+        ++argv;
+    }
+    PixelLayout rawLayout = PixelLayout::Rgb;
+    if ((argc != 2 && argc != 5 && argc != 6) || (argc > 2 && !ParsePixelLayout(argv[4], &rawLayout)) ||
+        maxDetections <= 0) {
+        std::cout << "USAGE: " << program << " [--max_faces=<n>] <image> [<width> <height> <format> [<stride>]]\n"
+                " *max_faces - most faces to detect (default 10)\n"
                 " *image - path to image\n"
+                " *format - rgb, bgr, rgba, gray, nv12 or yuv420 for raw frames\n"
                 << std::endl;
         return -1;
     }
     char *imagePath = argv[1];
+    const bool rawFrame = argc > 2;
+    const int rawWidth = rawFrame ? std::atoi(argv[2]) : 0;
+    const int rawHeight = rawFrame ? std::atoi(argv[3]) : 0;
+    const int rawStride = argc > 5 ? std::atoi(argv[5]) : 0;
 
      // Create FaceEngine root SDK object.
     fsdk::IFaceEnginePtr faceEngine = fsdk::acquire(fsdk::createFaceEngine("./data", "./data/faceengine.conf"));
@@ -70,21 +117,21 @@ int main(int argc, char *argv[])
 
 	// Load image.
     fsdk::Image image;
-    if (!image.load(imagePath, fsdk::Format::R8G8B8)) {
+    const bool loaded = rawFrame ?
+        loadRawFrame(imagePath, rawWidth, rawHeight, rawLayout, rawStride, image) :
+        image.load(imagePath, fsdk::Format::R8G8B8);
+    if (!loaded) {
         std::cerr << "Failed to load image: \"" << imagePath << "\"" << std::endl;
         return -1;
     }
 
     std::clog << "Detecting faces." << std::endl;
 
-   // Detect no more than 10 faces in the image.
-    enum { MaxDetections = 10 };
-
-    // Data used for detection.
-    fsdk::Detection detections[MaxDetections];
-    int detectionsCount(MaxDetections);
-    fsdk::Landmarks5 landmarks5[MaxDetections];
-    fsdk::Landmarks68 landmarks68[MaxDetections];
+    // Data used for detection, for no more than maxDetections faces.
+    std::vector<fsdk::Detection> detections(maxDetections);
+    int detectionsCount(maxDetections);
+    std::vector<fsdk::Landmarks5> landmarks5(maxDetections);
+    std::vector<fsdk::Landmarks68> landmarks68(maxDetections);
 
     // Detect faces in the image.
     fsdk::ResultValue<fsdk::FSDKError, int> detectorResult = faceDetector->detect(
@@ -0,0 +1,177 @@
+#include "metrics.h"
+
+#include <sstream>
+
+namespace metrics {
+
+namespace {
+
+const char* const StageNames[] = {
+	"image_load", "detect", "warp", "attributes", "quality", "head_pose", "overlap",
+};
+static_assert(sizeof(StageNames) / sizeof(StageNames[0]) == static_cast<size_t>(Stage::Count),
+	"every stage needs a name");
+
+const double Quantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+
+Histogram g_stageLatency[static_cast<int>(Stage::Count)];
+std::atomic<uint64_t> g_stageErrors[static_cast<int>(Stage::Count)];
+std::atomic<uint64_t> g_requests{0};
+std::atomic<uint64_t> g_faces{0};
+Histogram g_queueWait;
+std::atomic<uint64_t> g_rejected{0};
+std::atomic<uint64_t> g_abandoned{0};
+std::atomic<uint64_t> g_cacheHits{0};
+std::atomic<uint64_t> g_cacheMisses{0};
+std::atomic<uint64_t> g_cacheEvictions{0};
+std::atomic<int64_t> g_cachedBytes{0};
+
+}  // namespace
+
+int Histogram::bucketIndex(uint64_t micros) {
+	if (micros < SubBuckets)
+		return static_cast<int>(micros);
+	const int msb = 63 - __builtin_clzll(micros);
+	const int shift = msb - SubBucketBits;
+	const int index = (shift + 1) * SubBuckets + static_cast<int>((micros >> shift) & (SubBuckets - 1));
+	return index < BucketCount ? index : BucketCount - 1;
+}
+
+uint64_t Histogram::bucketUpperBound(int index) {
+	if (index < SubBuckets)
+		return index + 1;
+	const int shift = index / SubBuckets - 1;
+	const uint64_t lower = static_cast<uint64_t>(SubBuckets + index % SubBuckets) << shift;
+	return lower + (uint64_t(1) << shift);
+}
+
+void Histogram::record(uint64_t micros) {
+	buckets_[bucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+	count_.fetch_add(1, std::memory_order_relaxed);
+	sum_.fetch_add(micros, std::memory_order_relaxed);
+}
+
+uint64_t Histogram::quantile(double q) const {
+	const uint64_t total = count();
+	if (total == 0)
+		return 0;
+	const uint64_t rank = static_cast<uint64_t>(q * (total - 1)) + 1;
+	uint64_t seen = 0;
+	for (int i = 0; i < BucketCount; ++i) {
+		seen += buckets_[i].load(std::memory_order_relaxed);
+		if (seen >= rank)
+			return bucketUpperBound(i);
+	}
+	return bucketUpperBound(BucketCount - 1);
+}
+
+void RecordStage(Stage stage, std::chrono::steady_clock::duration elapsed) {
+	const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+	g_stageLatency[static_cast<int>(stage)].record(micros > 0 ? micros : 0);
+}
+
+std::chrono::microseconds TypicalStageLatency(Stage stage) {
+	return std::chrono::microseconds(g_stageLatency[static_cast<int>(stage)].quantile(0.5));
+}
+
+void RecordQueueWait(std::chrono::steady_clock::duration elapsed) {
+	const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+	g_queueWait.record(micros > 0 ? micros : 0);
+}
+
+void CountRejected() {
+	g_rejected.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CountAbandoned() {
+	g_abandoned.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CountCacheHit() {
+	g_cacheHits.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CountCacheMiss() {
+	g_cacheMisses.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CountCacheEviction() {
+	g_cacheEvictions.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AddCachedBytes(int64_t delta) {
+	g_cachedBytes.fetch_add(delta, std::memory_order_relaxed);
+}
+
+void CountRequest() {
+	g_requests.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CountFaces(int faces) {
+	g_faces.fetch_add(faces, std::memory_order_relaxed);
+}
+
+void CountError(Stage stage) {
+	g_stageErrors[static_cast<int>(stage)].fetch_add(1, std::memory_order_relaxed);
+}
+
+std::string RenderPrometheus() {
+	std::ostringstream out;
+	out << "# HELP luna_requests_total Images received for processing.\n"
+		"# TYPE luna_requests_total counter\n"
+		"luna_requests_total " << g_requests.load(std::memory_order_relaxed) << "\n"
+		"# HELP luna_faces_total Faces detected.\n"
+		"# TYPE luna_faces_total counter\n"
+		"luna_faces_total " << g_faces.load(std::memory_order_relaxed) << "\n"
+		"# HELP luna_rejected_total Calls rejected because the admission queue was full.\n"
+		"# TYPE luna_rejected_total counter\n"
+		"luna_rejected_total " << g_rejected.load(std::memory_order_relaxed) << "\n"
+		"# HELP luna_abandoned_total Calls dropped mid-pipeline as cancelled or past their deadline.\n"
+		"# TYPE luna_abandoned_total counter\n"
+		"luna_abandoned_total " << g_abandoned.load(std::memory_order_relaxed) << "\n"
+		"# HELP luna_result_cache_hits_total Calls answered from the result cache.\n"
+		"# TYPE luna_result_cache_hits_total counter\n"
+		"luna_result_cache_hits_total " << g_cacheHits.load(std::memory_order_relaxed) << "\n"
+		"# HELP luna_result_cache_misses_total Result cache lookups that found nothing.\n"
+		"# TYPE luna_result_cache_misses_total counter\n"
+		"luna_result_cache_misses_total " << g_cacheMisses.load(std::memory_order_relaxed) << "\n"
+		"# HELP luna_result_cache_evictions_total Results dropped from the cache to make room.\n"
+		"# TYPE luna_result_cache_evictions_total counter\n"
+		"luna_result_cache_evictions_total " << g_cacheEvictions.load(std::memory_order_relaxed) << "\n"
+		"# HELP luna_result_cache_bytes Memory held by cached results.\n"
+		"# TYPE luna_result_cache_bytes gauge\n"
+		"luna_result_cache_bytes " << g_cachedBytes.load(std::memory_order_relaxed) << "\n";
+
+	out << "# HELP luna_stage_errors_total Failed pipeline stages.\n"
+		"# TYPE luna_stage_errors_total counter\n";
+	for (int i = 0; i < static_cast<int>(Stage::Count); ++i) {
+		out << "luna_stage_errors_total{stage=\"" << StageNames[i] << "\"} "
+			<< g_stageErrors[i].load(std::memory_order_relaxed) << "\n";
+	}
+
+	out << "# HELP luna_stage_latency_seconds Time spent in each pipeline stage.\n"
+		"# TYPE luna_stage_latency_seconds summary\n";
+	for (int i = 0; i < static_cast<int>(Stage::Count); ++i) {
+		const Histogram& histogram = g_stageLatency[i];
+		for (double q : Quantiles) {
+			out << "luna_stage_latency_seconds{stage=\"" << StageNames[i] << "\",quantile=\"" << q << "\"} "
+				<< histogram.quantile(q) * 1e-6 << "\n";
+		}
+		out << "luna_stage_latency_seconds_sum{stage=\"" << StageNames[i] << "\"} "
+			<< histogram.sum() * 1e-6 << "\n"
+			"luna_stage_latency_seconds_count{stage=\"" << StageNames[i] << "\"} "
+			<< histogram.count() << "\n";
+	}
+
+	out << "# HELP luna_queue_wait_seconds Time from admission until processing starts.\n"
+		"# TYPE luna_queue_wait_seconds summary\n";
+	for (double q : Quantiles) {
+		out << "luna_queue_wait_seconds{quantile=\"" << q << "\"} "
+			<< g_queueWait.quantile(q) * 1e-6 << "\n";
+	}
+	out << "luna_queue_wait_seconds_sum " << g_queueWait.sum() * 1e-6 << "\n"
+		"luna_queue_wait_seconds_count " << g_queueWait.count() << "\n";
+	return out.str();
+}
+
+}  // namespace metrics
@@ -0,0 +1,89 @@
+#ifndef LUNAAPI_METRICS_H
+#define LUNAAPI_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Process-wide request metrics: a latency histogram per pipeline stage and
+// a few counters. Recording is a handful of relaxed atomic increments, so
+// it is always on.
+namespace metrics {
+
+enum class Stage {
+	ImageLoad,
+	Detect,
+	Warp,
+	Attributes,
+	Quality,
+	HeadPose,
+	Overlap,
+	Count
+};
+
+// Log-linear histogram in the spirit of HdrHistogram: values are bucketed
+// by power of two and each power of two is split into 8 linear
+// sub-buckets, which keeps every quantile within 12.5% of the true value.
+class Histogram {
+ public:
+	enum { SubBucketBits = 3, SubBuckets = 1 << SubBucketBits, BucketCount = SubBuckets * 61 };
+
+	void record(uint64_t micros);
+
+	uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+	uint64_t sum() const { return sum_.load(std::memory_order_relaxed); }
+
+	// Upper bound of the bucket holding the q-th quantile, 0 when empty.
+	uint64_t quantile(double q) const;
+
+ private:
+	static int bucketIndex(uint64_t micros);
+	static uint64_t bucketUpperBound(int index);
+
+	std::atomic<uint64_t> buckets_[BucketCount] = {};
+	std::atomic<uint64_t> count_{0};
+	std::atomic<uint64_t> sum_{0};
+};
+
+void RecordStage(Stage stage, std::chrono::steady_clock::duration elapsed);
+// Median recorded latency of stage; zero until it has run.
+std::chrono::microseconds TypicalStageLatency(Stage stage);
+void CountRequest();
+void CountFaces(int faces);
+void CountError(Stage stage);
+
+// Time from a call's admission until processing starts, and calls turned
+// away because the admission queue was full.
+void RecordQueueWait(std::chrono::steady_clock::duration elapsed);
+void CountRejected();
+// Work dropped because its call was cancelled or could not meet its
+// deadline.
+void CountAbandoned();
+
+// Result cache lookups, entries evicted to make room, and the bytes held.
+void CountCacheHit();
+void CountCacheMiss();
+void CountCacheEviction();
+void AddCachedBytes(int64_t delta);
+
+// Records the time from construction to destruction against a stage.
+class StageTimer {
+ public:
+	explicit StageTimer(Stage stage) : stage_(stage), start_(std::chrono::steady_clock::now()) {}
+	~StageTimer() { RecordStage(stage_, std::chrono::steady_clock::now() - start_); }
+
+ private:
+	StageTimer(const StageTimer&) = delete;
+	StageTimer& operator=(const StageTimer&) = delete;
+
+	Stage stage_;
+	std::chrono::steady_clock::time_point start_;
+};
+
+// All metrics in the Prometheus text exposition format.
+std::string RenderPrometheus();
+
+}  // namespace metrics
+
+#endif  // LUNAAPI_METRICS_H
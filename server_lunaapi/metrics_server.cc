@@ -0,0 +1,120 @@
+#include "metrics_server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "logger.h"
+#include "metrics.h"
+
+namespace {
+
+void WriteAll(int fd, const std::string& data) {
+	size_t written = 0;
+	while (written < data.size()) {
+		const ssize_t n = ::send(fd, data.data() + written, data.size() - written, MSG_NOSIGNAL);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return;
+		written += n;
+	}
+}
+
+}  // namespace
+
+MetricsServer::MetricsServer() {
+}
+
+MetricsServer::~MetricsServer() {
+	stopping_ = true;
+	if (thread_.joinable())
+		thread_.join();
+	if (listenFd_ >= 0)
+		::close(listenFd_);
+}
+
+bool MetricsServer::start(int port) {
+	listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+	if (listenFd_ < 0) {
+		LUNA_LOG(Error) << "Failed to create metrics socket: " << std::strerror(errno);
+		return false;
+	}
+	const int reuse = 1;
+	::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+	sockaddr_in address;
+	std::memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(static_cast<uint16_t>(port));
+	if (::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+		::listen(listenFd_, 16) != 0) {
+		LUNA_LOG(Error) << "Failed to listen for metrics on port " << port << ": " << std::strerror(errno);
+		return false;
+	}
+
+	thread_ = std::thread(&MetricsServer::run, this);
+	LUNA_LOG(Info) << "Metrics available on http://127.0.0.1:" << port << "/metrics";
+	return true;
+}
+
+void MetricsServer::run() {
+	while (!stopping_) {
+		// Wake up periodically to notice shutdown.
+		pollfd listening = { listenFd_, POLLIN, 0 };
+		if (::poll(&listening, 1, 200) <= 0)
+			continue;
+		const int fd = ::accept(listenFd_, nullptr, nullptr);
+		if (fd < 0)
+			continue;
+
+		// The request itself is irrelevant; read what has arrived and reply.
+		char request[1024];
+		pollfd client = { fd, POLLIN, 0 };
+		if (::poll(&client, 1, 1000) > 0)
+			(void)::recv(fd, request, sizeof(request), 0);
+
+		const std::string body = metrics::RenderPrometheus();
+		WriteAll(fd, "HTTP/1.0 200 OK\r\n"
+			"Content-Type: text/plain; version=0.0.4\r\n"
+			"Content-Length: " + std::to_string(body.size()) + "\r\n"
+			"Connection: close\r\n\r\n" + body);
+		::close(fd);
+	}
+}
+
+namespace metrics {
+
+void BlockDumpSignal(int signal) {
+	sigset_t signals;
+	sigemptyset(&signals);
+	sigaddset(&signals, signal);
+	pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+}
+
+void StartSignalDumper(int signal) {
+	std::thread([signal] {
+		sigset_t signals;
+		sigemptyset(&signals);
+		sigaddset(&signals, signal);
+		for (;;) {
+			int received = 0;
+			if (sigwait(&signals, &received) != 0)
+				continue;
+			const std::string page = RenderPrometheus();
+			std::fwrite(page.data(), 1, page.size(), stderr);
+			std::fflush(stderr);
+		}
+	}).detach();
+}
+
+}  // namespace metrics
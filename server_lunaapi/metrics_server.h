@@ -0,0 +1,40 @@
+#ifndef LUNAAPI_METRICS_SERVER_H
+#define LUNAAPI_METRICS_SERVER_H
+
+#include <atomic>
+#include <thread>
+
+// Serves metrics::RenderPrometheus() over plain HTTP on a loopback port,
+// answering every request with the full text page.
+class MetricsServer {
+ public:
+	MetricsServer();
+	~MetricsServer();
+
+	// Binds 127.0.0.1:port and starts the serving thread.
+	bool start(int port);
+
+ private:
+	MetricsServer(const MetricsServer&) = delete;
+	MetricsServer& operator=(const MetricsServer&) = delete;
+
+	void run();
+
+	int listenFd_ = -1;
+	std::atomic<bool> stopping_{false};
+	std::thread thread_;
+};
+
+namespace metrics {
+
+// Blocks signal in the calling thread and every thread it creates later.
+// Must run in main() before any thread is started.
+void BlockDumpSignal(int signal);
+
+// Starts a detached thread that writes the metrics page to stderr every
+// time signal is delivered to the process.
+void StartSignalDumper(int signal);
+
+}  // namespace metrics
+
+#endif  // LUNAAPI_METRICS_SERVER_H
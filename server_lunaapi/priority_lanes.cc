@@ -0,0 +1,41 @@
+#include "priority_lanes.h"
+
+#include <algorithm>
+
+const char* const LaneMetadataKey = "luna-priority";
+
+Lane LaneOf(const grpc::ServerContext* context) {
+	const auto& metadata = context->client_metadata();
+	const auto found = metadata.find(LaneMetadataKey);
+	if (found != metadata.end() && found->second == "bulk")
+		return Lane::Bulk;
+	return Lane::Interactive;
+}
+
+const char* LaneName(Lane lane) {
+	return lane == Lane::Bulk ? "bulk" : "interactive";
+}
+
+LaneScheduler::LaneScheduler(int slots, int reserved, int weight)
+	: bulkLimit_(std::max(1, slots - reserved)), weight_(std::max(1, weight)) {
+}
+
+bool LaneScheduler::mayStart(Lane lane) const {
+	return lane == Lane::Interactive || running_[static_cast<int>(Lane::Bulk)] < bulkLimit_;
+}
+
+bool LaneScheduler::pick(bool interactiveWaiting, bool bulkWaiting, Lane* lane) {
+	const bool bulkAllowed = bulkWaiting && mayStart(Lane::Bulk);
+	if (interactiveWaiting && (!bulkAllowed || streak_ < weight_)) {
+		if (bulkAllowed)
+			++streak_;
+		*lane = Lane::Interactive;
+	} else if (bulkAllowed) {
+		streak_ = 0;
+		*lane = Lane::Bulk;
+	} else {
+		return false;
+	}
+	started(*lane);
+	return true;
+}
@@ -0,0 +1,46 @@
+#ifndef LUNAAPI_PRIORITY_LANES_H
+#define LUNAAPI_PRIORITY_LANES_H
+
+#include <grpcpp/grpcpp.h>
+
+// Traffic classes sharing the server. Interactive calls (access control,
+// turnstiles) have latency targets; bulk calls (re-processing jobs) only
+// need throughput.
+enum class Lane { Interactive, Bulk, Count };
+
+// Client metadata key selecting the lane; "bulk" picks Lane::Bulk, anything
+// else, or no value, Lane::Interactive.
+extern const char* const LaneMetadataKey;
+
+Lane LaneOf(const grpc::ServerContext* context);
+const char* LaneName(Lane lane);
+
+// Decides which lane gets the next free slot of a pool of slots. Bulk work
+// never holds more than slots - reserved of them (but at least one), so
+// reserved slots are always left for interactive calls. While both lanes are waiting, bulk
+// gets one slot after every weight interactive ones. Not thread safe; the
+// owner calls it under its own lock.
+class LaneScheduler {
+ public:
+	LaneScheduler(int slots, int reserved, int weight);
+
+	// Picks the lane to start next from the lanes with waiting work and
+	// counts it as running. Returns false when nothing may start.
+	bool pick(bool interactiveWaiting, bool bulkWaiting, Lane* lane);
+
+	// Counts work started without waiting and ended work.
+	void started(Lane lane) { ++running_[static_cast<int>(lane)]; }
+	void finished(Lane lane) { --running_[static_cast<int>(lane)]; }
+
+	// Whether lane may start work on a free slot right now.
+	bool mayStart(Lane lane) const;
+
+ private:
+	const int bulkLimit_;
+	const int weight_;
+	int running_[static_cast<int>(Lane::Count)] = {};
+	// Interactive picks since bulk last got a slot while waiting.
+	int streak_ = 0;
+};
+
+#endif  // LUNAAPI_PRIORITY_LANES_H
@@ -0,0 +1,195 @@
+#include "raw_image_request.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+// Field numbers of LunaSDK.Image.
+enum {
+	FieldWidth = 1,
+	FieldHeight = 2,
+	FieldImageDataSize = 3,
+	FieldImageData = 4,
+	FieldOptions = 5,
+	FieldFormat = 6,
+	FieldStride = 7,
+	FieldEncoding = 8,
+};
+
+enum {
+	WireVarint = 0,
+	WireFixed64 = 1,
+	WireLengthDelimited = 2,
+	WireFixed32 = 5,
+};
+
+}  // namespace
+
+// Sequential protobuf wire-format reader over a list of slices.
+class RawImageRequest::Reader {
+ public:
+	explicit Reader(const std::vector<grpc::Slice>& slices) : slices_(slices) {
+		for (const grpc::Slice& slice : slices_)
+			remaining_ += slice.size();
+		skipEmpty();
+	}
+
+	bool atEnd() const { return slice_ == slices_.size(); }
+
+	bool readVarint(uint64_t* value) {
+		*value = 0;
+		for (int shift = 0; shift < 64; shift += 7) {
+			if (atEnd())
+				return false;
+			const uint8_t byte = slices_[slice_].begin()[offset_];
+			advance(1);
+			*value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+			if ((byte & 0x80) == 0)
+				return true;
+		}
+		return false;
+	}
+
+	bool skip(size_t length) {
+		if (length > remaining_)
+			return false;
+		while (length > 0) {
+			if (atEnd())
+				return false;
+			const size_t step = std::min(length, slices_[slice_].size() - offset_);
+			advance(step);
+			length -= step;
+		}
+		return true;
+	}
+
+	// Points data at the next length bytes. Only when they cross a slice
+	// boundary are they gathered into storage. length comes from the
+	// client, so it is checked against the received bytes before anything
+	// is allocated.
+	bool readBytes(size_t length, std::string* storage, const char** data) {
+		if (length == 0) {
+			*data = nullptr;
+			return true;
+		}
+		if (length > remaining_)
+			return false;
+		const grpc::Slice& slice = slices_[slice_];
+		if (slice.size() - offset_ >= length) {
+			*data = reinterpret_cast<const char*>(slice.begin()) + offset_;
+			advance(length);
+			return true;
+		}
+		storage->clear();
+		storage->reserve(length);
+		while (storage->size() < length) {
+			if (atEnd())
+				return false;
+			const grpc::Slice& part = slices_[slice_];
+			const size_t step = std::min(length - storage->size(), part.size() - offset_);
+			storage->append(reinterpret_cast<const char*>(part.begin()) + offset_, step);
+			advance(step);
+		}
+		*data = storage->data();
+		return true;
+	}
+
+ private:
+	void advance(size_t bytes) {
+		offset_ += bytes;
+		remaining_ -= bytes;
+		if (offset_ == slices_[slice_].size()) {
+			++slice_;
+			offset_ = 0;
+			skipEmpty();
+		}
+	}
+
+	void skipEmpty() {
+		while (slice_ < slices_.size() && slices_[slice_].size() == 0)
+			++slice_;
+	}
+
+	const std::vector<grpc::Slice>& slices_;
+	size_t slice_ = 0;
+	size_t offset_ = 0;
+	// Bytes not read yet, over all slices.
+	size_t remaining_ = 0;
+};
+
+bool RawImageRequest::parse(const grpc::ByteBuffer& buffer) {
+	// Dump only takes references on the slices; no bytes are copied.
+	if (!buffer.Dump(&slices_).ok())
+		return false;
+
+	Reader reader(slices_);
+	std::string optionsStorage;
+	while (!reader.atEnd()) {
+		uint64_t key = 0;
+		if (!reader.readVarint(&key))
+			return false;
+		const int field = static_cast<int>(key >> 3);
+		const int wireType = static_cast<int>(key & 7);
+
+		uint64_t value = 0;
+		switch (wireType) {
+		case WireVarint:
+			if (!reader.readVarint(&value))
+				return false;
+			if (field == FieldWidth)
+				width_ = static_cast<int>(value);
+			else if (field == FieldHeight)
+				height_ = static_cast<int>(value);
+			else if (field == FieldFormat && LunaSDK::PixelFormat_IsValid(static_cast<int>(value)))
+				format_ = static_cast<LunaSDK::PixelFormat>(value);
+			else if (field == FieldStride)
+				stride_ = static_cast<int>(value);
+			else if (field == FieldEncoding && LunaSDK::ImageEncoding_IsValid(static_cast<int>(value)))
+				encoding_ = static_cast<LunaSDK::ImageEncoding>(value);
+			break;
+		case WireLengthDelimited: {
+			if (!reader.readVarint(&value))
+				return false;
+			const char* bytes = nullptr;
+			if (field == FieldImageData) {
+				if (!reader.readBytes(value, &joined_, &bytes))
+					return false;
+				data_ = bytes;
+				size_ = value;
+			} else if (field == FieldOptions) {
+				if (!reader.readBytes(value, &optionsStorage, &bytes) ||
+					!options_.ParseFromArray(bytes, static_cast<int>(value)))
+					return false;
+			} else if (!reader.skip(value)) {
+				return false;
+			}
+			break;
+		}
+		case WireFixed64:
+			if (!reader.skip(8))
+				return false;
+			break;
+		case WireFixed32:
+			if (!reader.skip(4))
+				return false;
+			break;
+		default:
+			return false;
+		}
+	}
+	return true;
+}
+
+ImageRequestView RawImageRequest::view() const {
+	ImageRequestView view;
+	view.width = width_;
+	view.height = height_;
+	view.data = data_;
+	view.size = size_;
+	view.format = format_;
+	view.stride = stride_;
+	view.encoding = encoding_;
+	view.options = &options_;
+	return view;
+}
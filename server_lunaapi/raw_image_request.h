@@ -0,0 +1,40 @@
+#ifndef LUNAAPI_RAW_IMAGE_REQUEST_H
+#define LUNAAPI_RAW_IMAGE_REQUEST_H
+
+#include <string>
+#include <vector>
+
+#include <grpcpp/impl/codegen/byte_buffer.h>
+#include <grpcpp/impl/codegen/slice.h>
+
+#include "image_processor.h"
+#include "test_api.pb.h"
+
+// A LunaSDK.Image request read straight off the received grpc::ByteBuffer.
+// Only the small header fields are decoded; image_data is referenced where
+// it lies in the received slices and only copied when the transport split
+// it across slices.
+class RawImageRequest {
+ public:
+	// Returns false if the buffer is not a well-formed Image message.
+	bool parse(const grpc::ByteBuffer& buffer);
+
+	// Valid while this object lives.
+	ImageRequestView view() const;
+
+ private:
+	class Reader;
+
+	std::vector<grpc::Slice> slices_;
+	std::string joined_;
+	int width_ = 0;
+	int height_ = 0;
+	const char* data_ = nullptr;
+	size_t size_ = 0;
+	LunaSDK::PixelFormat format_ = LunaSDK::PIXEL_FORMAT_UNSPECIFIED;
+	int stride_ = 0;
+	LunaSDK::ImageEncoding encoding_ = LunaSDK::ENCODING_UNSPECIFIED;
+	LunaSDK::ProcessingOptions options_;
+};
+
+#endif  // LUNAAPI_RAW_IMAGE_REQUEST_H
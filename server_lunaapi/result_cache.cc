@@ -0,0 +1,166 @@
+#include "result_cache.h"
+
+#include <cstring>
+#include <iterator>
+
+#include "metrics.h"
+
+namespace {
+
+const uint64_t Prime1 = 0x9E3779B185EBCA87ull;
+const uint64_t Prime2 = 0xC2B2AE3D27D4EB4Full;
+const uint64_t Prime3 = 0x165667B19E3779F9ull;
+const uint64_t Prime4 = 0x85EBCA77C2B2AE63ull;
+const uint64_t Prime5 = 0x27D4EB2F165667C5ull;
+
+// Bookkeeping charged to each entry on top of its key and value: the list
+// and index nodes and the shared string.
+const size_t EntryOverhead = 128;
+
+inline uint64_t RotateLeft(uint64_t value, int bits) {
+	return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t Read64(const uint8_t* p) {
+	uint64_t value;
+	std::memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+inline uint32_t Read32(const uint8_t* p) {
+	uint32_t value;
+	std::memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+inline uint64_t Round(uint64_t acc, uint64_t input) {
+	acc += input * Prime2;
+	acc = RotateLeft(acc, 31);
+	return acc * Prime1;
+}
+
+inline uint64_t MergeRound(uint64_t acc, uint64_t value) {
+	acc ^= Round(0, value);
+	return acc * Prime1 + Prime4;
+}
+
+}  // namespace
+
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed) {
+	const uint8_t* p = static_cast<const uint8_t*>(data);
+	const uint8_t* const end = p + size;
+	uint64_t hash;
+
+	if (size >= 32) {
+		// Four independent lanes keep the multipliers busy.
+		uint64_t v1 = seed + Prime1 + Prime2;
+		uint64_t v2 = seed + Prime2;
+		uint64_t v3 = seed;
+		uint64_t v4 = seed - Prime1;
+		const uint8_t* const limit = end - 32;
+		do {
+			v1 = Round(v1, Read64(p));
+			v2 = Round(v2, Read64(p + 8));
+			v3 = Round(v3, Read64(p + 16));
+			v4 = Round(v4, Read64(p + 24));
+			p += 32;
+		} while (p <= limit);
+		hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+		hash = MergeRound(hash, v1);
+		hash = MergeRound(hash, v2);
+		hash = MergeRound(hash, v3);
+		hash = MergeRound(hash, v4);
+	} else {
+		hash = seed + Prime5;
+	}
+	hash += size;
+
+	for (; p + 8 <= end; p += 8) {
+		hash ^= Round(0, Read64(p));
+		hash = RotateLeft(hash, 27) * Prime1 + Prime4;
+	}
+	if (p + 4 <= end) {
+		hash ^= Read32(p) * Prime1;
+		hash = RotateLeft(hash, 23) * Prime2 + Prime3;
+		p += 4;
+	}
+	for (; p < end; ++p) {
+		hash ^= *p * Prime5;
+		hash = RotateLeft(hash, 11) * Prime1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= Prime2;
+	hash ^= hash >> 29;
+	hash *= Prime3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+ResultCache::ResultCache(size_t maxBytes, int shards)
+	: shardBytes_(maxBytes / (shards > 0 ? shards : 1)) {
+	for (int i = 0; i < (shards > 0 ? shards : 1); ++i)
+		shards_.emplace_back(new Shard());
+}
+
+ResultCache::Shard& ResultCache::shardOf(uint64_t hash) {
+	// The index buckets by the low bits; shards take the high ones.
+	return *shards_[(hash >> 32) % shards_.size()];
+}
+
+void ResultCache::erase(Shard& shard, std::list<Entry>::iterator entry) {
+	shard.bytes -= entry->bytes;
+	metrics::AddCachedBytes(-static_cast<int64_t>(entry->bytes));
+	shard.index.erase(entry->hash);
+	shard.entries.erase(entry);
+}
+
+bool ResultCache::mayHold(size_t imageBytes) const {
+	return imageBytes + EntryOverhead <= shardBytes_;
+}
+
+ResultCache::Value ResultCache::find(const ResultKey& key) {
+	Shard& shard = shardOf(key.hash);
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	const auto found = shard.index.find(key.hash);
+	// Same hash is not enough: the request must match byte for byte.
+	if (found == shard.index.end() || found->second->fields != key.fields ||
+		found->second->data.size() != key.size ||
+		(key.size > 0 && std::memcmp(found->second->data.data(), key.data, key.size) != 0)) {
+		metrics::CountCacheMiss();
+		return Value();
+	}
+	shard.entries.splice(shard.entries.begin(), shard.entries, found->second);
+	metrics::CountCacheHit();
+	return found->second->value;
+}
+
+void ResultCache::insert(const ResultKey& key, std::string value) {
+	const size_t bytes = key.fields.size() + key.size + value.size() + EntryOverhead;
+	if (bytes > shardBytes_)
+		return;
+	// Built outside the lock.
+	Entry entry;
+	entry.hash = key.hash;
+	entry.fields = key.fields;
+	if (key.size > 0)
+		entry.data.assign(static_cast<const char*>(key.data), key.size);
+	entry.value = std::make_shared<const std::string>(std::move(value));
+	entry.bytes = bytes;
+
+	Shard& shard = shardOf(key.hash);
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	// Replaces the entry of the same hash, either left by another call for
+	// the same image or a collision; one slot per hash is enough.
+	const auto found = shard.index.find(key.hash);
+	if (found != shard.index.end())
+		erase(shard, found->second);
+	while (!shard.entries.empty() && shard.bytes + bytes > shardBytes_) {
+		erase(shard, std::prev(shard.entries.end()));
+		metrics::CountCacheEviction();
+	}
+	shard.entries.push_front(std::move(entry));
+	shard.index.emplace(key.hash, shard.entries.begin());
+	shard.bytes += bytes;
+	metrics::AddCachedBytes(static_cast<int64_t>(bytes));
+}
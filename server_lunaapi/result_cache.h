@@ -0,0 +1,81 @@
+#ifndef LUNAAPI_RESULT_CACHE_H
+#define LUNAAPI_RESULT_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 64-bit hash of size bytes at data (XXH64). Runs at memory speed, so
+// hashing a multi-megabyte frame costs well under a millisecond.
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed);
+
+// What a result is cached under: everything the result depends on.
+struct ResultKey {
+	// HashBytes() of fields and the image bytes; only picks the slot.
+	uint64_t hash = 0;
+	// Serialized request fields other than the image bytes.
+	std::string fields;
+	// Image bytes, referenced where the request holds them.
+	const void* data = nullptr;
+	size_t size = 0;
+};
+
+// Serialized results of recently processed images. Entries are spread
+// over shards by key hash, each with its own lock and least-recently-used
+// list, so lookups from many threads rarely contend. Each entry keeps a
+// copy of its request's fields and image bytes, and a hit requires both to
+// match, so a hash collision never returns another image's result. The
+// copies count towards the size limit; each shard holds at most its share
+// of maxBytes.
+class ResultCache {
+ public:
+	typedef std::shared_ptr<const std::string> Value;
+
+	ResultCache(size_t maxBytes, int shards);
+
+	// False when no entry with an image of imageBytes would be kept, so
+	// such requests need not be hashed or looked up.
+	bool mayHold(size_t imageBytes) const;
+
+	// The value stored under key, or null. Counts a hit or miss.
+	Value find(const ResultKey& key);
+
+	// Stores value under a copy of key, evicting the least recently used
+	// entries of its shard to make room. Entries larger than a shard are
+	// not kept.
+	void insert(const ResultKey& key, std::string value);
+
+ private:
+	struct Entry {
+		uint64_t hash;
+		std::string fields;
+		std::string data;
+		Value value;
+		size_t bytes;
+	};
+
+	struct Shard {
+		std::mutex mutex;
+		// Most recently used first.
+		std::list<Entry> entries;
+		std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+		size_t bytes = 0;
+	};
+
+	ResultCache(const ResultCache&) = delete;
+	ResultCache& operator=(const ResultCache&) = delete;
+
+	Shard& shardOf(uint64_t hash);
+	// Unlinks an entry; the shard's lock must be held.
+	static void erase(Shard& shard, std::list<Entry>::iterator entry);
+
+	size_t shardBytes_;
+	std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+#endif  // LUNAAPI_RESULT_CACHE_H
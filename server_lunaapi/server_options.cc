@@ -0,0 +1,205 @@
+#include "server_options.h"
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+void PrintUsage(const char* program) {
+	std::cout << "USAGE: " << program << " [options]\n"
+		" --address=<host:port>  listening address (default 0.0.0.0:50051)\n"
+		" --data=<path>          FaceEngine data directory (default ./data)\n"
+		" --config=<path>        FaceEngine config (default ./data/faceengine.conf)\n"
+		" --pool_size=<n>        estimator sets to preload (default: hardware threads)\n"
+		" --mode=<sync|async|async_raw>  server implementation (default sync)\n"
+		" --cq_count=<n>         completion queues in async mode (default: hardware threads)\n"
+		" --queue_depth=<n>             calls waiting for a worker before rejecting, 0 disables (default 64)\n"
+		" --interactive_reserved=<n>    sets kept for interactive calls, -1 a quarter of the pool (default -1)\n"
+		" --interactive_weight=<n>      interactive calls served per bulk call (default 4)\n"
+		" --result_cache_mb=<n>         memory for cached results of repeated images, 0 disables (default 0)\n"
+		" --result_cache_shards=<n>     independently locked parts of the result cache (default 16)\n"
+		" --face_threads=<n>            threads sharing per-face estimation, 0 disables, -1 hardware threads - 1 (default 0)\n"
+		" --dump_warps=<dir>            save warped faces to dir for debugging (default off)\n"
+		" --dump_warps_queue=<n>        warps waiting to be saved before dropping (default 64)\n"
+		" --jpeg_target_side=<n>        decode large JPEGs at reduced scale down to n px, 0 disables (default 0)\n"
+		" --detect_max_side=<n>         detect on a pyramid level of at most n px, 0 disables (default 0)\n"
+		" --max_faces=<n>               faces per image unless the request asks (default 10)\n"
+		" --max_faces_limit=<n>         most faces a request may ask for (default 100)\n"
+		" --detector_min_face=<n>       smallest face the detector config finds, 0 disables (default 20)\n"
+		" --arena_initial_kb=<n>        initial block of per-call arenas in async modes (default 64)\n"
+		" --log_level=<level>           debug, info, warning, error or off (default info)\n"
+		" --log_sample=<n>              log per-face details for 1 in n faces (default 100)\n"
+		" --metrics_port=<n>            serve Prometheus metrics on 127.0.0.1:n (default off)\n"
+		" --metrics_dump_signal=<sig>   usr1 or usr2 dumps metrics to stderr (default off)\n"
+		<< std::endl;
+}
+
+// Returns value of "--name=value" argument or nullptr if arg is another option.
+const char* OptionValue(const char* arg, const char* name) {
+	const size_t len = std::strlen(name);
+	if (std::strncmp(arg, name, len) != 0 || arg[len] != '=')
+		return nullptr;
+	return arg + len + 1;
+}
+
+// Parses a decimal int in [minimum, 2^20]; only options with a documented
+// -1 pass a minimum below 0.
+bool ParseInt(const char* text, int* value, int minimum = 0) {
+	char* end = nullptr;
+	const long parsed = std::strtol(text, &end, 10);
+	if (end == text || *end != '\0' || parsed < minimum || parsed > 1 << 20)
+		return false;
+	*value = static_cast<int>(parsed);
+	return true;
+}
+
+}  // namespace
+
+bool ParseServerOptions(int argc, char** argv, ServerOptions* options) {
+	for (int i = 1; i < argc; ++i) {
+		const char* arg = argv[i];
+		const char* value = nullptr;
+		if ((value = OptionValue(arg, "--address")) != nullptr) {
+			options->address = value;
+		} else if ((value = OptionValue(arg, "--data")) != nullptr) {
+			options->dataPath = value;
+		} else if ((value = OptionValue(arg, "--config")) != nullptr) {
+			options->configPath = value;
+		} else if ((value = OptionValue(arg, "--pool_size")) != nullptr) {
+			if (!ParseInt(value, &options->poolSize)) {
+				std::cerr << "Invalid --pool_size: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--mode")) != nullptr) {
+			if (std::strcmp(value, "sync") == 0) {
+				options->mode = ServerMode::Sync;
+			} else if (std::strcmp(value, "async") == 0) {
+				options->mode = ServerMode::Async;
+			} else if (std::strcmp(value, "async_raw") == 0) {
+				options->mode = ServerMode::AsyncRaw;
+			} else {
+				std::cerr << "Invalid --mode: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--cq_count")) != nullptr) {
+			if (!ParseInt(value, &options->completionQueues)) {
+				std::cerr << "Invalid --cq_count: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--queue_depth")) != nullptr) {
+			if (!ParseInt(value, &options->queueDepth)) {
+				std::cerr << "Invalid --queue_depth: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--interactive_reserved")) != nullptr) {
+			if (!ParseInt(value, &options->interactiveReserved, -1)) {
+				std::cerr << "Invalid --interactive_reserved: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--interactive_weight")) != nullptr) {
+			if (!ParseInt(value, &options->interactiveWeight) || options->interactiveWeight == 0) {
+				std::cerr << "Invalid --interactive_weight: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--result_cache_mb")) != nullptr) {
+			if (!ParseInt(value, &options->resultCacheMb)) {
+				std::cerr << "Invalid --result_cache_mb: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--result_cache_shards")) != nullptr) {
+			if (!ParseInt(value, &options->resultCacheShards) || options->resultCacheShards == 0) {
+				std::cerr << "Invalid --result_cache_shards: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--face_threads")) != nullptr) {
+			if (!ParseInt(value, &options->faceThreads, -1)) {
+				std::cerr << "Invalid --face_threads: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--dump_warps")) != nullptr) {
+			options->dumpWarpsDir = value;
+		} else if ((value = OptionValue(arg, "--dump_warps_queue")) != nullptr) {
+			if (!ParseInt(value, &options->dumpWarpsQueue) || options->dumpWarpsQueue == 0) {
+				std::cerr << "Invalid --dump_warps_queue: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--jpeg_target_side")) != nullptr) {
+			if (!ParseInt(value, &options->jpegTargetSide)) {
+				std::cerr << "Invalid --jpeg_target_side: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--detect_max_side")) != nullptr) {
+			if (!ParseInt(value, &options->detectMaxSide)) {
+				std::cerr << "Invalid --detect_max_side: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--max_faces")) != nullptr) {
+			if (!ParseInt(value, &options->maxFaces) || options->maxFaces == 0) {
+				std::cerr << "Invalid --max_faces: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--max_faces_limit")) != nullptr) {
+			if (!ParseInt(value, &options->maxFacesLimit) || options->maxFacesLimit == 0) {
+				std::cerr << "Invalid --max_faces_limit: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--detector_min_face")) != nullptr) {
+			if (!ParseInt(value, &options->detectorMinFace)) {
+				std::cerr << "Invalid --detector_min_face: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--arena_initial_kb")) != nullptr) {
+			if (!ParseInt(value, &options->arenaInitialKb) || options->arenaInitialKb == 0) {
+				std::cerr << "Invalid --arena_initial_kb: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--log_level")) != nullptr) {
+			if (!logging::ParseLevel(value, &options->logLevel)) {
+				std::cerr << "Invalid --log_level: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--log_sample")) != nullptr) {
+			if (!ParseInt(value, &options->logSampleEvery) || options->logSampleEvery == 0) {
+				std::cerr << "Invalid --log_sample: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--metrics_port")) != nullptr) {
+			if (!ParseInt(value, &options->metricsPort) || options->metricsPort > 65535) {
+				std::cerr << "Invalid --metrics_port: " << value << std::endl;
+				return false;
+			}
+		} else if ((value = OptionValue(arg, "--metrics_dump_signal")) != nullptr) {
+			if (std::strcmp(value, "usr1") == 0) {
+				options->metricsDumpSignal = SIGUSR1;
+			} else if (std::strcmp(value, "usr2") == 0) {
+				options->metricsDumpSignal = SIGUSR2;
+			} else if (std::strcmp(value, "off") == 0) {
+				options->metricsDumpSignal = 0;
+			} else {
+				std::cerr << "Invalid --metrics_dump_signal: " << value << std::endl;
+				return false;
+			}
+		} else {
+			std::cerr << "Unknown argument: " << arg << std::endl;
+			PrintUsage(argv[0]);
+			return false;
+		}
+	}
+
+	const unsigned threads = std::thread::hardware_concurrency();
+	const int defaultThreads = threads > 0 ? static_cast<int>(threads) : 1;
+	if (options->poolSize == 0)
+		options->poolSize = defaultThreads;
+	if (options->completionQueues == 0)
+		options->completionQueues = defaultThreads;
+	if (options->interactiveReserved < 0)
+		options->interactiveReserved = options->poolSize / 4;
+	if (options->faceThreads < 0)
+		options->faceThreads = defaultThreads - 1;
+	if (options->maxFaces > options->maxFacesLimit)
+		options->maxFaces = options->maxFacesLimit;
+	return true;
+}
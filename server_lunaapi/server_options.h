@@ -0,0 +1,103 @@
+#ifndef LUNAAPI_SERVER_OPTIONS_H
+#define LUNAAPI_SERVER_OPTIONS_H
+
+#include <string>
+
+#include "logger.h"
+
+// How incoming calls are served.
+enum class ServerMode {
+	// gRPC sync server; each in-flight call occupies a gRPC thread.
+	Sync,
+	// Completion queues plus a dedicated inference worker pool.
+	Async,
+	// Async, with Proccesing requests parsed straight from the received
+	// buffers so image bytes are never copied into a protobuf string.
+	AsyncRaw,
+};
+
+// Startup configuration of the server, filled from the command line.
+struct ServerOptions {
+	std::string address = "0.0.0.0:50051";
+	std::string dataPath = "./data";
+	std::string configPath = "./data/faceengine.conf";
+
+	// Number of estimator sets created at startup. Bounds the number of
+	// images processed concurrently. 0 means one per hardware thread.
+	int poolSize = 0;
+
+	ServerMode mode = ServerMode::Sync;
+
+	// Completion queues (each with a polling thread) in async mode.
+	// 0 means one per hardware thread.
+	int completionQueues = 0;
+
+	// Calls allowed to wait for an estimator set on top of those being
+	// processed; more are rejected with RESOURCE_EXHAUSTED. 0 disables.
+	int queueDepth = 64;
+
+	// Priority lanes, picked per call with the "luna-priority: bulk"
+	// metadata. Estimator sets and workers kept for interactive calls, -1
+	// meaning a quarter of the pool; and interactive calls served for each
+	// bulk one while both wait.
+	int interactiveReserved = -1;
+	int interactiveWeight = 4;
+
+	// Serialized results of recent images, answering repeats without the
+	// SDK. Entries keep a copy of their image to verify hits; both count
+	// towards resultCacheMb megabytes, and images larger than a shard's
+	// share are not cached. 0 disables.
+	int resultCacheMb = 0;
+	int resultCacheShards = 16;
+
+	// Threads estimating the faces of an image in parallel, next to the
+	// request's own thread. Each holds a full estimator set on top of the
+	// pool's and competes with other requests for the CPU, so this pays off
+	// for few concurrent crowd images. 0 disables; -1 means one less than
+	// the hardware threads.
+	int faceThreads = 0;
+
+	// Directory for debug warp captures; empty disables them.
+	std::string dumpWarpsDir;
+	int dumpWarpsQueue = 64;
+
+	// JPEGs with a longer side of at least twice this are decoded at 1/2,
+	// 1/4 or 1/8 scale, keeping the longer side at or above it. Warps and
+	// estimates then use the reduced image too, so results change; 0
+	// decodes at full size. detectMaxSide reduces detection only.
+	int jpegTargetSide = 0;
+
+	// Larger images are detected on a 1/2, 1/4 or 1/8 pyramid level with
+	// a longer side of at most this; estimation still uses full resolution.
+	// 0 disables.
+	int detectMaxSide = 0;
+
+	// Faces per image when a request does not say, and the most a request
+	// may ask for.
+	int maxFaces = 10;
+	int maxFacesLimit = 100;
+
+	// Minimum face size of the detector configuration, used to skip
+	// detector pyramid levels for requests with a larger MinFaceSize.
+	// 0 disables.
+	int detectorMinFace = 20;
+
+	// Preallocated block of each pooled protobuf arena used by the async
+	// server for requests and replies.
+	int arenaInitialKb = 64;
+
+	LogLevel logLevel = LogLevel::Info;
+	// Per-face messages are logged for one in this many faces.
+	int logSampleEvery = 100;
+
+	// Loopback port of the Prometheus endpoint; 0 disables it.
+	int metricsPort = 0;
+	// Signal that dumps metrics to stderr (SIGUSR1/SIGUSR2); 0 disables it.
+	int metricsDumpSignal = 0;
+};
+
+// Parses --name=value arguments into options. Prints usage and returns
+// false on unknown or malformed arguments.
+bool ParseServerOptions(int argc, char** argv, ServerOptions* options);
+
+#endif  // LUNAAPI_SERVER_OPTIONS_H
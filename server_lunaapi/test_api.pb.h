@@ -1,1637 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: test_api.proto
-
-#ifndef PROTOBUF_INCLUDED_test_5fapi_2eproto
-#define PROTOBUF_INCLUDED_test_5fapi_2eproto
-
-#include <string>
-
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
-#error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
-#error your headers.
-#endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
-#error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
-#error regenerate this file with a newer version of protoc.
-#endif
-
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/arena.h>
-#include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
-#include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
-#include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
-#include <google/protobuf/extension_set.h>  // IWYU pragma: export
-#include <google/protobuf/unknown_field_set.h>
-// @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_test_5fapi_2eproto 
-
-namespace protobuf_test_5fapi_2eproto {
-// Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[7];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
-};
-void AddDescriptors();
-}  // namespace protobuf_test_5fapi_2eproto
-namespace LunaSDK {
-class FaceFountAttribute;
-class FaceFountAttributeDefaultTypeInternal;
-extern FaceFountAttributeDefaultTypeInternal _FaceFountAttribute_default_instance_;
-class HeadPoseFaceFountAttribute;
-class HeadPoseFaceFountAttributeDefaultTypeInternal;
-extern HeadPoseFaceFountAttributeDefaultTypeInternal _HeadPoseFaceFountAttribute_default_instance_;
-class Image;
-class ImageDefaultTypeInternal;
-extern ImageDefaultTypeInternal _Image_default_instance_;
-class ImageProccesing;
-class ImageProccesingDefaultTypeInternal;
-extern ImageProccesingDefaultTypeInternal _ImageProccesing_default_instance_;
-class ImageProccessingResult;
-class ImageProccessingResultDefaultTypeInternal;
-extern ImageProccessingResultDefaultTypeInternal _ImageProccessingResult_default_instance_;
-class QualityFaceFountAttribute;
-class QualityFaceFountAttributeDefaultTypeInternal;
-extern QualityFaceFountAttributeDefaultTypeInternal _QualityFaceFountAttribute_default_instance_;
-class Rectangle;
-class RectangleDefaultTypeInternal;
-extern RectangleDefaultTypeInternal _Rectangle_default_instance_;
-}  // namespace LunaSDK
-namespace google {
-namespace protobuf {
-template<> ::LunaSDK::FaceFountAttribute* Arena::CreateMaybeMessage<::LunaSDK::FaceFountAttribute>(Arena*);
-template<> ::LunaSDK::HeadPoseFaceFountAttribute* Arena::CreateMaybeMessage<::LunaSDK::HeadPoseFaceFountAttribute>(Arena*);
-template<> ::LunaSDK::Image* Arena::CreateMaybeMessage<::LunaSDK::Image>(Arena*);
-template<> ::LunaSDK::ImageProccesing* Arena::CreateMaybeMessage<::LunaSDK::ImageProccesing>(Arena*);
-template<> ::LunaSDK::ImageProccessingResult* Arena::CreateMaybeMessage<::LunaSDK::ImageProccessingResult>(Arena*);
-template<> ::LunaSDK::QualityFaceFountAttribute* Arena::CreateMaybeMessage<::LunaSDK::QualityFaceFountAttribute>(Arena*);
-template<> ::LunaSDK::Rectangle* Arena::CreateMaybeMessage<::LunaSDK::Rectangle>(Arena*);
-}  // namespace protobuf
-}  // namespace google
-namespace LunaSDK {
-
-// ===================================================================
-
-class Image : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:LunaSDK.Image) */ {
- public:
-  Image();
-  virtual ~Image();
-
-  Image(const Image& from);
-
-  inline Image& operator=(const Image& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
-  Image(Image&& from) noexcept
-    : Image() {
-    *this = ::std::move(from);
-  }
-
-  inline Image& operator=(Image&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Image& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Image* internal_default_instance() {
-    return reinterpret_cast<const Image*>(
-               &_Image_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    0;
-
-  void Swap(Image* other);
-  friend void swap(Image& a, Image& b) {
-    a.Swap(&b);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline Image* New() const final {
-    return CreateMaybeMessage<Image>(NULL);
-  }
-
-  Image* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Image>(arena);
-  }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const Image& from);
-  void MergeFrom(const Image& from);
-  void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Image* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
-  }
-  public:
-
-  ::google::protobuf::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // bytes image_data = 4;
-  void clear_image_data();
-  static const int kImageDataFieldNumber = 4;
-  const ::std::string& image_data() const;
-  void set_image_data(const ::std::string& value);
-  #if LANG_CXX11
-  void set_image_data(::std::string&& value);
-  #endif
-  void set_image_data(const char* value);
-  void set_image_data(const void* value, size_t size);
-  ::std::string* mutable_image_data();
-  ::std::string* release_image_data();
-  void set_allocated_image_data(::std::string* image_data);
-
-  // int32 width = 1;
-  void clear_width();
-  static const int kWidthFieldNumber = 1;
-  ::google::protobuf::int32 width() const;
-  void set_width(::google::protobuf::int32 value);
-
-  // int32 height = 2;
-  void clear_height();
-  static const int kHeightFieldNumber = 2;
-  ::google::protobuf::int32 height() const;
-  void set_height(::google::protobuf::int32 value);
-
-  // int32 image_data_size = 3;
-  void clear_image_data_size();
-  static const int kImageDataSizeFieldNumber = 3;
-  ::google::protobuf::int32 image_data_size() const;
-  void set_image_data_size(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:LunaSDK.Image)
- private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr image_data_;
-  ::google::protobuf::int32 width_;
-  ::google::protobuf::int32 height_;
-  ::google::protobuf::int32 image_data_size_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_test_5fapi_2eproto::TableStruct;
-};
-// -------------------------------------------------------------------
-
-class ImageProccesing : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:LunaSDK.ImageProccesing) */ {
- public:
-  ImageProccesing();
-  virtual ~ImageProccesing();
-
-  ImageProccesing(const ImageProccesing& from);
-
-  inline ImageProccesing& operator=(const ImageProccesing& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
-  ImageProccesing(ImageProccesing&& from) noexcept
-    : ImageProccesing() {
-    *this = ::std::move(from);
-  }
-
-  inline ImageProccesing& operator=(ImageProccesing&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ImageProccesing& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ImageProccesing* internal_default_instance() {
-    return reinterpret_cast<const ImageProccesing*>(
-               &_ImageProccesing_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    1;
-
-  void Swap(ImageProccesing* other);
-  friend void swap(ImageProccesing& a, ImageProccesing& b) {
-    a.Swap(&b);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ImageProccesing* New() const final {
-    return CreateMaybeMessage<ImageProccesing>(NULL);
-  }
-
-  ImageProccesing* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<ImageProccesing>(arena);
-  }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const ImageProccesing& from);
-  void MergeFrom(const ImageProccesing& from);
-  void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ImageProccesing* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
-  }
-  public:
-
-  ::google::protobuf::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // .LunaSDK.Image Photo = 2;
-  bool has_photo() const;
-  void clear_photo();
-  static const int kPhotoFieldNumber = 2;
-  private:
-  const ::LunaSDK::Image& _internal_photo() const;
-  public:
-  const ::LunaSDK::Image& photo() const;
-  ::LunaSDK::Image* release_photo();
-  ::LunaSDK::Image* mutable_photo();
-  void set_allocated_photo(::LunaSDK::Image* photo);
-
-  // int32 ID_Request = 1;
-  void clear_id_request();
-  static const int kIDRequestFieldNumber = 1;
-  ::google::protobuf::int32 id_request() const;
-  void set_id_request(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:LunaSDK.ImageProccesing)
- private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::LunaSDK::Image* photo_;
-  ::google::protobuf::int32 id_request_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_test_5fapi_2eproto::TableStruct;
-};
-// -------------------------------------------------------------------
-
-class QualityFaceFountAttribute : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:LunaSDK.QualityFaceFountAttribute) */ {
- public:
-  QualityFaceFountAttribute();
-  virtual ~QualityFaceFountAttribute();
-
-  QualityFaceFountAttribute(const QualityFaceFountAttribute& from);
-
-  inline QualityFaceFountAttribute& operator=(const QualityFaceFountAttribute& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
-  QualityFaceFountAttribute(QualityFaceFountAttribute&& from) noexcept
-    : QualityFaceFountAttribute() {
-    *this = ::std::move(from);
-  }
-
-  inline QualityFaceFountAttribute& operator=(QualityFaceFountAttribute&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const QualityFaceFountAttribute& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const QualityFaceFountAttribute* internal_default_instance() {
-    return reinterpret_cast<const QualityFaceFountAttribute*>(
-               &_QualityFaceFountAttribute_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    2;
-
-  void Swap(QualityFaceFountAttribute* other);
-  friend void swap(QualityFaceFountAttribute& a, QualityFaceFountAttribute& b) {
-    a.Swap(&b);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline QualityFaceFountAttribute* New() const final {
-    return CreateMaybeMessage<QualityFaceFountAttribute>(NULL);
-  }
-
-  QualityFaceFountAttribute* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<QualityFaceFountAttribute>(arena);
-  }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const QualityFaceFountAttribute& from);
-  void MergeFrom(const QualityFaceFountAttribute& from);
-  void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(QualityFaceFountAttribute* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
-  }
-  public:
-
-  ::google::protobuf::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // double dark = 1;
-  void clear_dark();
-  static const int kDarkFieldNumber = 1;
-  double dark() const;
-  void set_dark(double value);
-
-  // double ligth = 2;
-  void clear_ligth();
-  static const int kLigthFieldNumber = 2;
-  double ligth() const;
-  void set_ligth(double value);
-
-  // double gray = 3;
-  void clear_gray();
-  static const int kGrayFieldNumber = 3;
-  double gray() const;
-  void set_gray(double value);
-
-  // double blur = 4;
-  void clear_blur();
-  static const int kBlurFieldNumber = 4;
-  double blur() const;
-  void set_blur(double value);
-
-  // double quality = 5;
-  void clear_quality();
-  static const int kQualityFieldNumber = 5;
-  double quality() const;
-  void set_quality(double value);
-
-  // double threshold = 6;
-  void clear_threshold();
-  static const int kThresholdFieldNumber = 6;
-  double threshold() const;
-  void set_threshold(double value);
-
-  // @@protoc_insertion_point(class_scope:LunaSDK.QualityFaceFountAttribute)
- private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  double dark_;
-  double ligth_;
-  double gray_;
-  double blur_;
-  double quality_;
-  double threshold_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_test_5fapi_2eproto::TableStruct;
-};
-// -------------------------------------------------------------------
-
-class HeadPoseFaceFountAttribute : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:LunaSDK.HeadPoseFaceFountAttribute) */ {
- public:
-  HeadPoseFaceFountAttribute();
-  virtual ~HeadPoseFaceFountAttribute();
-
-  HeadPoseFaceFountAttribute(const HeadPoseFaceFountAttribute& from);
-
-  inline HeadPoseFaceFountAttribute& operator=(const HeadPoseFaceFountAttribute& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
-  HeadPoseFaceFountAttribute(HeadPoseFaceFountAttribute&& from) noexcept
-    : HeadPoseFaceFountAttribute() {
-    *this = ::std::move(from);
-  }
-
-  inline HeadPoseFaceFountAttribute& operator=(HeadPoseFaceFountAttribute&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HeadPoseFaceFountAttribute& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const HeadPoseFaceFountAttribute* internal_default_instance() {
-    return reinterpret_cast<const HeadPoseFaceFountAttribute*>(
-               &_HeadPoseFaceFountAttribute_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    3;
-
-  void Swap(HeadPoseFaceFountAttribute* other);
-  friend void swap(HeadPoseFaceFountAttribute& a, HeadPoseFaceFountAttribute& b) {
-    a.Swap(&b);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline HeadPoseFaceFountAttribute* New() const final {
-    return CreateMaybeMessage<HeadPoseFaceFountAttribute>(NULL);
-  }
-
-  HeadPoseFaceFountAttribute* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<HeadPoseFaceFountAttribute>(arena);
-  }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const HeadPoseFaceFountAttribute& from);
-  void MergeFrom(const HeadPoseFaceFountAttribute& from);
-  void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(HeadPoseFaceFountAttribute* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
-  }
-  public:
-
-  ::google::protobuf::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // float pitch = 1;
-  void clear_pitch();
-  static const int kPitchFieldNumber = 1;
-  float pitch() const;
-  void set_pitch(float value);
-
-  // float yaw = 2;
-  void clear_yaw();
-  static const int kYawFieldNumber = 2;
-  float yaw() const;
-  void set_yaw(float value);
-
-  // float roll = 3;
-  void clear_roll();
-  static const int kRollFieldNumber = 3;
-  float roll() const;
-  void set_roll(float value);
-
-  // @@protoc_insertion_point(class_scope:LunaSDK.HeadPoseFaceFountAttribute)
- private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  float pitch_;
-  float yaw_;
-  float roll_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_test_5fapi_2eproto::TableStruct;
-};
-// -------------------------------------------------------------------
-
-class Rectangle : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:LunaSDK.Rectangle) */ {
- public:
-  Rectangle();
-  virtual ~Rectangle();
-
-  Rectangle(const Rectangle& from);
-
-  inline Rectangle& operator=(const Rectangle& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
-  Rectangle(Rectangle&& from) noexcept
-    : Rectangle() {
-    *this = ::std::move(from);
-  }
-
-  inline Rectangle& operator=(Rectangle&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Rectangle& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Rectangle* internal_default_instance() {
-    return reinterpret_cast<const Rectangle*>(
-               &_Rectangle_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    4;
-
-  void Swap(Rectangle* other);
-  friend void swap(Rectangle& a, Rectangle& b) {
-    a.Swap(&b);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline Rectangle* New() const final {
-    return CreateMaybeMessage<Rectangle>(NULL);
-  }
-
-  Rectangle* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<Rectangle>(arena);
-  }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const Rectangle& from);
-  void MergeFrom(const Rectangle& from);
-  void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Rectangle* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
-  }
-  public:
-
-  ::google::protobuf::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // int32 x = 1;
-  void clear_x();
-  static const int kXFieldNumber = 1;
-  ::google::protobuf::int32 x() const;
-  void set_x(::google::protobuf::int32 value);
-
-  // int32 y = 2;
-  void clear_y();
-  static const int kYFieldNumber = 2;
-  ::google::protobuf::int32 y() const;
-  void set_y(::google::protobuf::int32 value);
-
-  // int32 width = 3;
-  void clear_width();
-  static const int kWidthFieldNumber = 3;
-  ::google::protobuf::int32 width() const;
-  void set_width(::google::protobuf::int32 value);
-
-  // int32 height = 4;
-  void clear_height();
-  static const int kHeightFieldNumber = 4;
-  ::google::protobuf::int32 height() const;
-  void set_height(::google::protobuf::int32 value);
-
-  // @@protoc_insertion_point(class_scope:LunaSDK.Rectangle)
- private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::int32 x_;
-  ::google::protobuf::int32 y_;
-  ::google::protobuf::int32 width_;
-  ::google::protobuf::int32 height_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_test_5fapi_2eproto::TableStruct;
-};
-// -------------------------------------------------------------------
-
-class FaceFountAttribute : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:LunaSDK.FaceFountAttribute) */ {
- public:
-  FaceFountAttribute();
-  virtual ~FaceFountAttribute();
-
-  FaceFountAttribute(const FaceFountAttribute& from);
-
-  inline FaceFountAttribute& operator=(const FaceFountAttribute& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
-  FaceFountAttribute(FaceFountAttribute&& from) noexcept
-    : FaceFountAttribute() {
-    *this = ::std::move(from);
-  }
-
-  inline FaceFountAttribute& operator=(FaceFountAttribute&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const FaceFountAttribute& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const FaceFountAttribute* internal_default_instance() {
-    return reinterpret_cast<const FaceFountAttribute*>(
-               &_FaceFountAttribute_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    5;
-
-  void Swap(FaceFountAttribute* other);
-  friend void swap(FaceFountAttribute& a, FaceFountAttribute& b) {
-    a.Swap(&b);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline FaceFountAttribute* New() const final {
-    return CreateMaybeMessage<FaceFountAttribute>(NULL);
-  }
-
-  FaceFountAttribute* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<FaceFountAttribute>(arena);
-  }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const FaceFountAttribute& from);
-  void MergeFrom(const FaceFountAttribute& from);
-  void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(FaceFountAttribute* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
-  }
-  public:
-
-  ::google::protobuf::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // .LunaSDK.Rectangle rect = 1;
-  bool has_rect() const;
-  void clear_rect();
-  static const int kRectFieldNumber = 1;
-  private:
-  const ::LunaSDK::Rectangle& _internal_rect() const;
-  public:
-  const ::LunaSDK::Rectangle& rect() const;
-  ::LunaSDK::Rectangle* release_rect();
-  ::LunaSDK::Rectangle* mutable_rect();
-  void set_allocated_rect(::LunaSDK::Rectangle* rect);
-
-  // .LunaSDK.Image WarpIamge = 3;
-  bool has_warpiamge() const;
-  void clear_warpiamge();
-  static const int kWarpIamgeFieldNumber = 3;
-  private:
-  const ::LunaSDK::Image& _internal_warpiamge() const;
-  public:
-  const ::LunaSDK::Image& warpiamge() const;
-  ::LunaSDK::Image* release_warpiamge();
-  ::LunaSDK::Image* mutable_warpiamge();
-  void set_allocated_warpiamge(::LunaSDK::Image* warpiamge);
-
-  // .LunaSDK.HeadPoseFaceFountAttribute HeadPos = 4;
-  bool has_headpos() const;
-  void clear_headpos();
-  static const int kHeadPosFieldNumber = 4;
-  private:
-  const ::LunaSDK::HeadPoseFaceFountAttribute& _internal_headpos() const;
-  public:
-  const ::LunaSDK::HeadPoseFaceFountAttribute& headpos() const;
-  ::LunaSDK::HeadPoseFaceFountAttribute* release_headpos();
-  ::LunaSDK::HeadPoseFaceFountAttribute* mutable_headpos();
-  void set_allocated_headpos(::LunaSDK::HeadPoseFaceFountAttribute* headpos);
-
-  // .LunaSDK.QualityFaceFountAttribute Quality = 5;
-  bool has_quality() const;
-  void clear_quality();
-  static const int kQualityFieldNumber = 5;
-  private:
-  const ::LunaSDK::QualityFaceFountAttribute& _internal_quality() const;
-  public:
-  const ::LunaSDK::QualityFaceFountAttribute& quality() const;
-  ::LunaSDK::QualityFaceFountAttribute* release_quality();
-  ::LunaSDK::QualityFaceFountAttribute* mutable_quality();
-  void set_allocated_quality(::LunaSDK::QualityFaceFountAttribute* quality);
-
-  // double score = 2;
-  void clear_score();
-  static const int kScoreFieldNumber = 2;
-  double score() const;
-  void set_score(double value);
-
-  // @@protoc_insertion_point(class_scope:LunaSDK.FaceFountAttribute)
- private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::LunaSDK::Rectangle* rect_;
-  ::LunaSDK::Image* warpiamge_;
-  ::LunaSDK::HeadPoseFaceFountAttribute* headpos_;
-  ::LunaSDK::QualityFaceFountAttribute* quality_;
-  double score_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_test_5fapi_2eproto::TableStruct;
-};
-// -------------------------------------------------------------------
-
-class ImageProccessingResult : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:LunaSDK.ImageProccessingResult) */ {
- public:
-  ImageProccessingResult();
-  virtual ~ImageProccessingResult();
-
-  ImageProccessingResult(const ImageProccessingResult& from);
-
-  inline ImageProccessingResult& operator=(const ImageProccessingResult& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
-  ImageProccessingResult(ImageProccessingResult&& from) noexcept
-    : ImageProccessingResult() {
-    *this = ::std::move(from);
-  }
-
-  inline ImageProccessingResult& operator=(ImageProccessingResult&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ImageProccessingResult& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ImageProccessingResult* internal_default_instance() {
-    return reinterpret_cast<const ImageProccessingResult*>(
-               &_ImageProccessingResult_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    6;
-
-  void Swap(ImageProccessingResult* other);
-  friend void swap(ImageProccessingResult& a, ImageProccessingResult& b) {
-    a.Swap(&b);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ImageProccessingResult* New() const final {
-    return CreateMaybeMessage<ImageProccessingResult>(NULL);
-  }
-
-  ImageProccessingResult* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<ImageProccessingResult>(arena);
-  }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const ImageProccessingResult& from);
-  void MergeFrom(const ImageProccessingResult& from);
-  void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ImageProccessingResult* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
-  }
-  public:
-
-  ::google::protobuf::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  // repeated .LunaSDK.FaceFountAttribute FaceFounts = 1;
-  int facefounts_size() const;
-  void clear_facefounts();
-  static const int kFaceFountsFieldNumber = 1;
-  ::LunaSDK::FaceFountAttribute* mutable_facefounts(int index);
-  ::google::protobuf::RepeatedPtrField< ::LunaSDK::FaceFountAttribute >*
-      mutable_facefounts();
-  const ::LunaSDK::FaceFountAttribute& facefounts(int index) const;
-  ::LunaSDK::FaceFountAttribute* add_facefounts();
-  const ::google::protobuf::RepeatedPtrField< ::LunaSDK::FaceFountAttribute >&
-      facefounts() const;
-
-  // @@protoc_insertion_point(class_scope:LunaSDK.ImageProccessingResult)
- private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::LunaSDK::FaceFountAttribute > facefounts_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_test_5fapi_2eproto::TableStruct;
-};
-// ===================================================================
-
-
-// ===================================================================
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Image
-
-// int32 width = 1;
-inline void Image::clear_width() {
-  width_ = 0;
-}
-inline ::google::protobuf::int32 Image::width() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.Image.width)
-  return width_;
-}
-inline void Image::set_width(::google::protobuf::int32 value) {
-  
-  width_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.Image.width)
-}
-
-// int32 height = 2;
-inline void Image::clear_height() {
-  height_ = 0;
-}
-inline ::google::protobuf::int32 Image::height() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.Image.height)
-  return height_;
-}
-inline void Image::set_height(::google::protobuf::int32 value) {
-  
-  height_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.Image.height)
-}
-
-// int32 image_data_size = 3;
-inline void Image::clear_image_data_size() {
-  image_data_size_ = 0;
-}
-inline ::google::protobuf::int32 Image::image_data_size() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.Image.image_data_size)
-  return image_data_size_;
-}
-inline void Image::set_image_data_size(::google::protobuf::int32 value) {
-  
-  image_data_size_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.Image.image_data_size)
-}
-
-// bytes image_data = 4;
-inline void Image::clear_image_data() {
-  image_data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& Image::image_data() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.Image.image_data)
-  return image_data_.GetNoArena();
-}
-inline void Image::set_image_data(const ::std::string& value) {
-  
-  image_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:LunaSDK.Image.image_data)
-}
-#if LANG_CXX11
-inline void Image::set_image_data(::std::string&& value) {
-  
-  image_data_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:LunaSDK.Image.image_data)
-}
-#endif
-inline void Image::set_image_data(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  image_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:LunaSDK.Image.image_data)
-}
-inline void Image::set_image_data(const void* value, size_t size) {
-  
-  image_data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:LunaSDK.Image.image_data)
-}
-inline ::std::string* Image::mutable_image_data() {
-  
-  // @@protoc_insertion_point(field_mutable:LunaSDK.Image.image_data)
-  return image_data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* Image::release_image_data() {
-  // @@protoc_insertion_point(field_release:LunaSDK.Image.image_data)
-  
-  return image_data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void Image::set_allocated_image_data(::std::string* image_data) {
-  if (image_data != NULL) {
-    
-  } else {
-    
-  }
-  image_data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), image_data);
-  // @@protoc_insertion_point(field_set_allocated:LunaSDK.Image.image_data)
-}
-
-// -------------------------------------------------------------------
-
-// ImageProccesing
-
-// int32 ID_Request = 1;
-inline void ImageProccesing::clear_id_request() {
-  id_request_ = 0;
-}
-inline ::google::protobuf::int32 ImageProccesing::id_request() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.ImageProccesing.ID_Request)
-  return id_request_;
-}
-inline void ImageProccesing::set_id_request(::google::protobuf::int32 value) {
-  
-  id_request_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.ImageProccesing.ID_Request)
-}
-
-// .LunaSDK.Image Photo = 2;
-inline bool ImageProccesing::has_photo() const {
-  return this != internal_default_instance() && photo_ != NULL;
-}
-inline void ImageProccesing::clear_photo() {
-  if (GetArenaNoVirtual() == NULL && photo_ != NULL) {
-    delete photo_;
-  }
-  photo_ = NULL;
-}
-inline const ::LunaSDK::Image& ImageProccesing::_internal_photo() const {
-  return *photo_;
-}
-inline const ::LunaSDK::Image& ImageProccesing::photo() const {
-  const ::LunaSDK::Image* p = photo_;
-  // @@protoc_insertion_point(field_get:LunaSDK.ImageProccesing.Photo)
-  return p != NULL ? *p : *reinterpret_cast<const ::LunaSDK::Image*>(
-      &::LunaSDK::_Image_default_instance_);
-}
-inline ::LunaSDK::Image* ImageProccesing::release_photo() {
-  // @@protoc_insertion_point(field_release:LunaSDK.ImageProccesing.Photo)
-  
-  ::LunaSDK::Image* temp = photo_;
-  photo_ = NULL;
-  return temp;
-}
-inline ::LunaSDK::Image* ImageProccesing::mutable_photo() {
-  
-  if (photo_ == NULL) {
-    auto* p = CreateMaybeMessage<::LunaSDK::Image>(GetArenaNoVirtual());
-    photo_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:LunaSDK.ImageProccesing.Photo)
-  return photo_;
-}
-inline void ImageProccesing::set_allocated_photo(::LunaSDK::Image* photo) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete photo_;
-  }
-  if (photo) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      photo = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, photo, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  photo_ = photo;
-  // @@protoc_insertion_point(field_set_allocated:LunaSDK.ImageProccesing.Photo)
-}
-
-// -------------------------------------------------------------------
-
-// QualityFaceFountAttribute
-
-// double dark = 1;
-inline void QualityFaceFountAttribute::clear_dark() {
-  dark_ = 0;
-}
-inline double QualityFaceFountAttribute::dark() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.QualityFaceFountAttribute.dark)
-  return dark_;
-}
-inline void QualityFaceFountAttribute::set_dark(double value) {
-  
-  dark_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.QualityFaceFountAttribute.dark)
-}
-
-// double ligth = 2;
-inline void QualityFaceFountAttribute::clear_ligth() {
-  ligth_ = 0;
-}
-inline double QualityFaceFountAttribute::ligth() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.QualityFaceFountAttribute.ligth)
-  return ligth_;
-}
-inline void QualityFaceFountAttribute::set_ligth(double value) {
-  
-  ligth_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.QualityFaceFountAttribute.ligth)
-}
-
-// double gray = 3;
-inline void QualityFaceFountAttribute::clear_gray() {
-  gray_ = 0;
-}
-inline double QualityFaceFountAttribute::gray() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.QualityFaceFountAttribute.gray)
-  return gray_;
-}
-inline void QualityFaceFountAttribute::set_gray(double value) {
-  
-  gray_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.QualityFaceFountAttribute.gray)
-}
-
-// double blur = 4;
-inline void QualityFaceFountAttribute::clear_blur() {
-  blur_ = 0;
-}
-inline double QualityFaceFountAttribute::blur() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.QualityFaceFountAttribute.blur)
-  return blur_;
-}
-inline void QualityFaceFountAttribute::set_blur(double value) {
-  
-  blur_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.QualityFaceFountAttribute.blur)
-}
-
-// double quality = 5;
-inline void QualityFaceFountAttribute::clear_quality() {
-  quality_ = 0;
-}
-inline double QualityFaceFountAttribute::quality() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.QualityFaceFountAttribute.quality)
-  return quality_;
-}
-inline void QualityFaceFountAttribute::set_quality(double value) {
-  
-  quality_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.QualityFaceFountAttribute.quality)
-}
-
-// double threshold = 6;
-inline void QualityFaceFountAttribute::clear_threshold() {
-  threshold_ = 0;
-}
-inline double QualityFaceFountAttribute::threshold() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.QualityFaceFountAttribute.threshold)
-  return threshold_;
-}
-inline void QualityFaceFountAttribute::set_threshold(double value) {
-  
-  threshold_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.QualityFaceFountAttribute.threshold)
-}
-
-// -------------------------------------------------------------------
-
-// HeadPoseFaceFountAttribute
-
-// float pitch = 1;
-inline void HeadPoseFaceFountAttribute::clear_pitch() {
-  pitch_ = 0;
-}
-inline float HeadPoseFaceFountAttribute::pitch() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.HeadPoseFaceFountAttribute.pitch)
-  return pitch_;
-}
-inline void HeadPoseFaceFountAttribute::set_pitch(float value) {
-  
-  pitch_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.HeadPoseFaceFountAttribute.pitch)
-}
-
-// float yaw = 2;
-inline void HeadPoseFaceFountAttribute::clear_yaw() {
-  yaw_ = 0;
-}
-inline float HeadPoseFaceFountAttribute::yaw() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.HeadPoseFaceFountAttribute.yaw)
-  return yaw_;
-}
-inline void HeadPoseFaceFountAttribute::set_yaw(float value) {
-  
-  yaw_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.HeadPoseFaceFountAttribute.yaw)
-}
-
-// float roll = 3;
-inline void HeadPoseFaceFountAttribute::clear_roll() {
-  roll_ = 0;
-}
-inline float HeadPoseFaceFountAttribute::roll() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.HeadPoseFaceFountAttribute.roll)
-  return roll_;
-}
-inline void HeadPoseFaceFountAttribute::set_roll(float value) {
-  
-  roll_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.HeadPoseFaceFountAttribute.roll)
-}
-
-// -------------------------------------------------------------------
-
-// Rectangle
-
-// int32 x = 1;
-inline void Rectangle::clear_x() {
-  x_ = 0;
-}
-inline ::google::protobuf::int32 Rectangle::x() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.Rectangle.x)
-  return x_;
-}
-inline void Rectangle::set_x(::google::protobuf::int32 value) {
-  
-  x_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.Rectangle.x)
-}
-
-// int32 y = 2;
-inline void Rectangle::clear_y() {
-  y_ = 0;
-}
-inline ::google::protobuf::int32 Rectangle::y() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.Rectangle.y)
-  return y_;
-}
-inline void Rectangle::set_y(::google::protobuf::int32 value) {
-  
-  y_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.Rectangle.y)
-}
-
-// int32 width = 3;
-inline void Rectangle::clear_width() {
-  width_ = 0;
-}
-inline ::google::protobuf::int32 Rectangle::width() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.Rectangle.width)
-  return width_;
-}
-inline void Rectangle::set_width(::google::protobuf::int32 value) {
-  
-  width_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.Rectangle.width)
-}
-
-// int32 height = 4;
-inline void Rectangle::clear_height() {
-  height_ = 0;
-}
-inline ::google::protobuf::int32 Rectangle::height() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.Rectangle.height)
-  return height_;
-}
-inline void Rectangle::set_height(::google::protobuf::int32 value) {
-  
-  height_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.Rectangle.height)
-}
-
-// -------------------------------------------------------------------
-
-// FaceFountAttribute
-
-// .LunaSDK.Rectangle rect = 1;
-inline bool FaceFountAttribute::has_rect() const {
-  return this != internal_default_instance() && rect_ != NULL;
-}
-inline void FaceFountAttribute::clear_rect() {
-  if (GetArenaNoVirtual() == NULL && rect_ != NULL) {
-    delete rect_;
-  }
-  rect_ = NULL;
-}
-inline const ::LunaSDK::Rectangle& FaceFountAttribute::_internal_rect() const {
-  return *rect_;
-}
-inline const ::LunaSDK::Rectangle& FaceFountAttribute::rect() const {
-  const ::LunaSDK::Rectangle* p = rect_;
-  // @@protoc_insertion_point(field_get:LunaSDK.FaceFountAttribute.rect)
-  return p != NULL ? *p : *reinterpret_cast<const ::LunaSDK::Rectangle*>(
-      &::LunaSDK::_Rectangle_default_instance_);
-}
-inline ::LunaSDK::Rectangle* FaceFountAttribute::release_rect() {
-  // @@protoc_insertion_point(field_release:LunaSDK.FaceFountAttribute.rect)
-  
-  ::LunaSDK::Rectangle* temp = rect_;
-  rect_ = NULL;
-  return temp;
-}
-inline ::LunaSDK::Rectangle* FaceFountAttribute::mutable_rect() {
-  
-  if (rect_ == NULL) {
-    auto* p = CreateMaybeMessage<::LunaSDK::Rectangle>(GetArenaNoVirtual());
-    rect_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:LunaSDK.FaceFountAttribute.rect)
-  return rect_;
-}
-inline void FaceFountAttribute::set_allocated_rect(::LunaSDK::Rectangle* rect) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete rect_;
-  }
-  if (rect) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      rect = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, rect, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  rect_ = rect;
-  // @@protoc_insertion_point(field_set_allocated:LunaSDK.FaceFountAttribute.rect)
-}
-
-// double score = 2;
-inline void FaceFountAttribute::clear_score() {
-  score_ = 0;
-}
-inline double FaceFountAttribute::score() const {
-  // @@protoc_insertion_point(field_get:LunaSDK.FaceFountAttribute.score)
-  return score_;
-}
-inline void FaceFountAttribute::set_score(double value) {
-  
-  score_ = value;
-  // @@protoc_insertion_point(field_set:LunaSDK.FaceFountAttribute.score)
-}
-
-// .LunaSDK.Image WarpIamge = 3;
-inline bool FaceFountAttribute::has_warpiamge() const {
-  return this != internal_default_instance() && warpiamge_ != NULL;
-}
-inline void FaceFountAttribute::clear_warpiamge() {
-  if (GetArenaNoVirtual() == NULL && warpiamge_ != NULL) {
-    delete warpiamge_;
-  }
-  warpiamge_ = NULL;
-}
-inline const ::LunaSDK::Image& FaceFountAttribute::_internal_warpiamge() const {
-  return *warpiamge_;
-}
-inline const ::LunaSDK::Image& FaceFountAttribute::warpiamge() const {
-  const ::LunaSDK::Image* p = warpiamge_;
-  // @@protoc_insertion_point(field_get:LunaSDK.FaceFountAttribute.WarpIamge)
-  return p != NULL ? *p : *reinterpret_cast<const ::LunaSDK::Image*>(
-      &::LunaSDK::_Image_default_instance_);
-}
-inline ::LunaSDK::Image* FaceFountAttribute::release_warpiamge() {
-  // @@protoc_insertion_point(field_release:LunaSDK.FaceFountAttribute.WarpIamge)
-  
-  ::LunaSDK::Image* temp = warpiamge_;
-  warpiamge_ = NULL;
-  return temp;
-}
-inline ::LunaSDK::Image* FaceFountAttribute::mutable_warpiamge() {
-  
-  if (warpiamge_ == NULL) {
-    auto* p = CreateMaybeMessage<::LunaSDK::Image>(GetArenaNoVirtual());
-    warpiamge_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:LunaSDK.FaceFountAttribute.WarpIamge)
-  return warpiamge_;
-}
-inline void FaceFountAttribute::set_allocated_warpiamge(::LunaSDK::Image* warpiamge) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete warpiamge_;
-  }
-  if (warpiamge) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      warpiamge = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, warpiamge, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  warpiamge_ = warpiamge;
-  // @@protoc_insertion_point(field_set_allocated:LunaSDK.FaceFountAttribute.WarpIamge)
-}
-
-// .LunaSDK.HeadPoseFaceFountAttribute HeadPos = 4;
-inline bool FaceFountAttribute::has_headpos() const {
-  return this != internal_default_instance() && headpos_ != NULL;
-}
-inline void FaceFountAttribute::clear_headpos() {
-  if (GetArenaNoVirtual() == NULL && headpos_ != NULL) {
-    delete headpos_;
-  }
-  headpos_ = NULL;
-}
-inline const ::LunaSDK::HeadPoseFaceFountAttribute& FaceFountAttribute::_internal_headpos() const {
-  return *headpos_;
-}
-inline const ::LunaSDK::HeadPoseFaceFountAttribute& FaceFountAttribute::headpos() const {
-  const ::LunaSDK::HeadPoseFaceFountAttribute* p = headpos_;
-  // @@protoc_insertion_point(field_get:LunaSDK.FaceFountAttribute.HeadPos)
-  return p != NULL ? *p : *reinterpret_cast<const ::LunaSDK::HeadPoseFaceFountAttribute*>(
-      &::LunaSDK::_HeadPoseFaceFountAttribute_default_instance_);
-}
-inline ::LunaSDK::HeadPoseFaceFountAttribute* FaceFountAttribute::release_headpos() {
-  // @@protoc_insertion_point(field_release:LunaSDK.FaceFountAttribute.HeadPos)
-  
-  ::LunaSDK::HeadPoseFaceFountAttribute* temp = headpos_;
-  headpos_ = NULL;
-  return temp;
-}
-inline ::LunaSDK::HeadPoseFaceFountAttribute* FaceFountAttribute::mutable_headpos() {
-  
-  if (headpos_ == NULL) {
-    auto* p = CreateMaybeMessage<::LunaSDK::HeadPoseFaceFountAttribute>(GetArenaNoVirtual());
-    headpos_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:LunaSDK.FaceFountAttribute.HeadPos)
-  return headpos_;
-}
-inline void FaceFountAttribute::set_allocated_headpos(::LunaSDK::HeadPoseFaceFountAttribute* headpos) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete headpos_;
-  }
-  if (headpos) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      headpos = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, headpos, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  headpos_ = headpos;
-  // @@protoc_insertion_point(field_set_allocated:LunaSDK.FaceFountAttribute.HeadPos)
-}
-
-// .LunaSDK.QualityFaceFountAttribute Quality = 5;
-inline bool FaceFountAttribute::has_quality() const {
-  return this != internal_default_instance() && quality_ != NULL;
-}
-inline void FaceFountAttribute::clear_quality() {
-  if (GetArenaNoVirtual() == NULL && quality_ != NULL) {
-    delete quality_;
-  }
-  quality_ = NULL;
-}
-inline const ::LunaSDK::QualityFaceFountAttribute& FaceFountAttribute::_internal_quality() const {
-  return *quality_;
-}
-inline const ::LunaSDK::QualityFaceFountAttribute& FaceFountAttribute::quality() const {
-  const ::LunaSDK::QualityFaceFountAttribute* p = quality_;
-  // @@protoc_insertion_point(field_get:LunaSDK.FaceFountAttribute.Quality)
-  return p != NULL ? *p : *reinterpret_cast<const ::LunaSDK::QualityFaceFountAttribute*>(
-      &::LunaSDK::_QualityFaceFountAttribute_default_instance_);
-}
-inline ::LunaSDK::QualityFaceFountAttribute* FaceFountAttribute::release_quality() {
-  // @@protoc_insertion_point(field_release:LunaSDK.FaceFountAttribute.Quality)
-  
-  ::LunaSDK::QualityFaceFountAttribute* temp = quality_;
-  quality_ = NULL;
-  return temp;
-}
-inline ::LunaSDK::QualityFaceFountAttribute* FaceFountAttribute::mutable_quality() {
-  
-  if (quality_ == NULL) {
-    auto* p = CreateMaybeMessage<::LunaSDK::QualityFaceFountAttribute>(GetArenaNoVirtual());
-    quality_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:LunaSDK.FaceFountAttribute.Quality)
-  return quality_;
-}
-inline void FaceFountAttribute::set_allocated_quality(::LunaSDK::QualityFaceFountAttribute* quality) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete quality_;
-  }
-  if (quality) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      quality = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, quality, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  quality_ = quality;
-  // @@protoc_insertion_point(field_set_allocated:LunaSDK.FaceFountAttribute.Quality)
-}
-
-// -------------------------------------------------------------------
-
-// ImageProccessingResult
-
-// repeated .LunaSDK.FaceFountAttribute FaceFounts = 1;
-inline int ImageProccessingResult::facefounts_size() const {
-  return facefounts_.size();
-}
-inline void ImageProccessingResult::clear_facefounts() {
-  facefounts_.Clear();
-}
-inline ::LunaSDK::FaceFountAttribute* ImageProccessingResult::mutable_facefounts(int index) {
-  // @@protoc_insertion_point(field_mutable:LunaSDK.ImageProccessingResult.FaceFounts)
-  return facefounts_.Mutable(index);
-}
-inline ::google::protobuf::RepeatedPtrField< ::LunaSDK::FaceFountAttribute >*
-ImageProccessingResult::mutable_facefounts() {
-  // @@protoc_insertion_point(field_mutable_list:LunaSDK.ImageProccessingResult.FaceFounts)
-  return &facefounts_;
-}
-inline const ::LunaSDK::FaceFountAttribute& ImageProccessingResult::facefounts(int index) const {
-  // @@protoc_insertion_point(field_get:LunaSDK.ImageProccessingResult.FaceFounts)
-  return facefounts_.Get(index);
-}
-inline ::LunaSDK::FaceFountAttribute* ImageProccessingResult::add_facefounts() {
-  // @@protoc_insertion_point(field_add:LunaSDK.ImageProccessingResult.FaceFounts)
-  return facefounts_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::LunaSDK::FaceFountAttribute >&
-ImageProccessingResult::facefounts() const {
-  // @@protoc_insertion_point(field_list:LunaSDK.ImageProccessingResult.FaceFounts)
-  return facefounts_;
-}
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace LunaSDK
-
-// @@protoc_insertion_point(global_scope)
-
-#endif  // PROTOBUF_INCLUDED_test_5fapi_2eproto
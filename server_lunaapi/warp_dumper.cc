@@ -0,0 +1,33 @@
+#include "warp_dumper.h"
+
+#include "logger.h"
+
+WarpDumper::WarpDumper(const std::string& directory, size_t queueDepth)
+	: directory_(directory), queue_(queueDepth), writer_(&WarpDumper::run, this) {
+}
+
+WarpDumper::~WarpDumper() {
+	queue_.close();
+	writer_.join();
+}
+
+void WarpDumper::capture(const fsdk::Image& warp, uint64_t requestId, int faceIndex) {
+	Capture capture;
+	capture.warp = warp;
+	capture.requestId = requestId;
+	capture.faceIndex = faceIndex;
+	if (!queue_.tryPush(std::move(capture)))
+		++dropped_;
+}
+
+void WarpDumper::run() {
+	Capture capture;
+	while (queue_.pop(&capture)) {
+		const std::string path = directory_ + "/warp_" + std::to_string(capture.requestId) +
+			"_" + std::to_string(capture.faceIndex) + ".ppm";
+		if (!capture.warp.save(path.c_str()))
+			LUNA_LOG(Warning) << "Failed to save warp " << path;
+		// Release the pixels now rather than when the next capture arrives.
+		capture.warp = fsdk::Image();
+	}
+}
@@ -0,0 +1,48 @@
+#ifndef LUNAAPI_WARP_DUMPER_H
+#define LUNAAPI_WARP_DUMPER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <fsdk/FaceEngine.h>
+
+#include "bounded_queue.h"
+
+// Debug capture of warped faces. Warps are queued to a background writer
+// thread; when the queue is full they are dropped rather than slowing the
+// request down.
+class WarpDumper {
+ public:
+	WarpDumper(const std::string& directory, size_t queueDepth);
+	~WarpDumper();
+
+	// Returns an id unique within the process, used to name a request's files.
+	uint64_t nextRequestId() { return nextRequestId_++; }
+
+	// Queues the warp as <directory>/warp_<requestId>_<faceIndex>.ppm.
+	void capture(const fsdk::Image& warp, uint64_t requestId, int faceIndex);
+
+	uint64_t dropped() const { return dropped_; }
+
+ private:
+	struct Capture {
+		fsdk::Image warp;
+		uint64_t requestId;
+		int faceIndex;
+	};
+
+	WarpDumper(const WarpDumper&) = delete;
+	WarpDumper& operator=(const WarpDumper&) = delete;
+
+	void run();
+
+	const std::string directory_;
+	BoundedQueue<Capture> queue_;
+	std::atomic<uint64_t> nextRequestId_{0};
+	std::atomic<uint64_t> dropped_{0};
+	std::thread writer_;
+};
+
+#endif  // LUNAAPI_WARP_DUMPER_H
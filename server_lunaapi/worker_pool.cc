@@ -0,0 +1,71 @@
+#include "worker_pool.h"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(int threads) : WorkerPool(threads, 0, 1) {
+}
+
+WorkerPool::WorkerPool(int threads, int reserved, int weight) : lanes_(threads, reserved, weight) {
+	for (int i = 0; i < threads; ++i)
+		threads_.emplace_back(&WorkerPool::run, this);
+}
+
+WorkerPool::~WorkerPool() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stopping_ = true;
+	}
+	wakeup_.notify_all();
+	for (std::thread& thread : threads_)
+		thread.join();
+}
+
+bool WorkerPool::Later(const Entry& a, const Entry& b) {
+	if (a.deadline != b.deadline)
+		return a.deadline > b.deadline;
+	return a.sequence > b.sequence;
+}
+
+void WorkerPool::submit(std::function<void()> task) {
+	submit(std::move(task), Clock::time_point::max(), Lane::Interactive);
+}
+
+void WorkerPool::submit(std::function<void()> task, Clock::time_point deadline, Lane lane) {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::vector<Entry>& tasks = tasks_[static_cast<int>(lane)];
+		tasks.push_back(Entry{deadline, nextSequence_++, std::move(task)});
+		std::push_heap(tasks.begin(), tasks.end(), Later);
+	}
+	wakeup_.notify_one();
+}
+
+void WorkerPool::run() {
+	std::vector<Entry>& interactive = tasks_[static_cast<int>(Lane::Interactive)];
+	std::vector<Entry>& bulk = tasks_[static_cast<int>(Lane::Bulk)];
+	for (;;) {
+		std::function<void()> task;
+		Lane lane;
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			// Bulk tasks may be queued yet held back by the reservation.
+			while (!lanes_.pick(!interactive.empty(), !bulk.empty(), &lane)) {
+				if (stopping_ && interactive.empty() && bulk.empty())
+					return;
+				wakeup_.wait(lock);
+			}
+			std::vector<Entry>& tasks = tasks_[static_cast<int>(lane)];
+			std::pop_heap(tasks.begin(), tasks.end(), Later);
+			task = std::move(tasks.back().task);
+			tasks.pop_back();
+		}
+		task();
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			lanes_.finished(lane);
+		}
+		// A freed bulk slot may let a held back task start.
+		if (lane == Lane::Bulk)
+			wakeup_.notify_one();
+	}
+}
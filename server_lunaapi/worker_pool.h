@@ -0,0 +1,55 @@
+#ifndef LUNAAPI_WORKER_POOL_H
+#define LUNAAPI_WORKER_POOL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "priority_lanes.h"
+
+// Fixed set of threads running submitted tasks. A LaneScheduler picks the
+// lane of the next task; within a lane tasks run earliest deadline first,
+// and those with equal deadlines, including all without one, in FIFO
+// order.
+class WorkerPool {
+ public:
+	typedef std::chrono::steady_clock Clock;
+
+	// See LaneScheduler for reserved and weight.
+	explicit WorkerPool(int threads);
+	WorkerPool(int threads, int reserved, int weight);
+	~WorkerPool();
+
+	// An interactive task without a deadline.
+	void submit(std::function<void()> task);
+	void submit(std::function<void()> task, Clock::time_point deadline, Lane lane);
+
+ private:
+	struct Entry {
+		Clock::time_point deadline;
+		uint64_t sequence;
+		std::function<void()> task;
+	};
+
+	// Orders the heap so the earliest deadline, then oldest entry, is on top.
+	static bool Later(const Entry& a, const Entry& b);
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	void run();
+
+	std::mutex mutex_;
+	std::condition_variable wakeup_;
+	std::vector<Entry> tasks_[static_cast<int>(Lane::Count)];
+	LaneScheduler lanes_;
+	uint64_t nextSequence_ = 0;
+	bool stopping_ = false;
+	std::vector<std::thread> threads_;
+};
+
+#endif  // LUNAAPI_WORKER_POOL_H